@@ -2896,6 +2896,11 @@ void VerilatedContext::threads(unsigned n) {
 
 void VerilatedContext::useNumaAssign(bool flag) { m_useNumaAssign = flag; }
 
+void VerilatedContext::threadsWaitPolicy(VerilatedWaitPolicy policy) {
+    m_threadsWaitPolicy = policy;
+    if (m_threadPool) static_cast<VlThreadPool*>(m_threadPool.get())->waitPolicy(policy);
+}
+
 void VerilatedContext::commandArgs(int argc, const char** argv) VL_MT_SAFE_EXCLUDES(m_argMutex) {
     // Not locking m_argMutex here, it is done in impp()->commandArgsAddGuts
     // m_argMutex here is the same as in impp()->commandArgsAddGuts;
@@ -3088,6 +3093,12 @@ void VerilatedContextImp::commandArgVl(const std::string& arg) {
         } else if (commandArgVlUint64(arg, "+verilator+seed+", u64, 1,
                                       std::numeric_limits<int>::max())) {
             randSeed(static_cast<int>(u64));
+        } else if (arg == "+verilator+threads+wait+spin") {
+            threadsWaitPolicy(VerilatedWaitPolicy::SPIN);
+        } else if (arg == "+verilator+threads+wait+adaptive") {
+            threadsWaitPolicy(VerilatedWaitPolicy::ADAPTIVE);
+        } else if (arg == "+verilator+threads+wait+block") {
+            threadsWaitPolicy(VerilatedWaitPolicy::BLOCK);
         } else if (arg == "+verilator+V") {
             VerilatedImp::versionDump();  // Someday more info too
             VL_FATAL_MT("COMMAND_LINE", 0, "",
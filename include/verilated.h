@@ -178,6 +178,12 @@ enum class VerilatedAssertDirectiveType : uint8_t {
     DIRECTIVE_TYPE_COVER = (1 << 1),
     DIRECTIVE_TYPE_ASSUME = (1 << 2),
 };
+// Policy of threads waiting for mtask dependencies, see VerilatedContext::threadsWaitPolicy
+enum class VerilatedWaitPolicy : uint8_t {
+    SPIN = 0,  // Spin, then yield (default)
+    ADAPTIVE = 1,  // Spin for a per-thread calibrated time, then block in the kernel
+    BLOCK = 2,  // Block in the kernel, best on oversubscribed hosts
+};
 using VerilatedAssertType_t = std::underlying_type<VerilatedAssertType>::type;
 using VerilatedAssertDirectiveType_t = std::underlying_type<VerilatedAssertDirectiveType>::type;
 
@@ -435,6 +441,8 @@ protected:
     unsigned m_threads = VlOs::getProcessDefaultParallelism();
     // Use numa automatic CPU-to-thread assignment
     bool m_useNumaAssign = false;
+    // How threads wait for mtask dependencies
+    VerilatedWaitPolicy m_threadsWaitPolicy = VerilatedWaitPolicy::SPIN;
     // Number of threads in added models
     unsigned m_threadsInModels = 0;
     // The thread pool shared by all models added to this context
@@ -608,6 +616,13 @@ public:
     /// call this to override back to false if numa assignment not wanted.
     void useNumaAssign(bool flag);
 
+    /// Get how threads wait for mtask dependencies
+    VerilatedWaitPolicy threadsWaitPolicy() const VL_MT_SAFE { return m_threadsWaitPolicy; }
+    /// Set how threads wait for mtask dependencies. SPIN gives the lowest
+    /// latency on dedicated hosts, BLOCK frees the CPU on oversubscribed hosts,
+    /// ADAPTIVE spins for as long as waits usually take, then blocks.
+    void threadsWaitPolicy(VerilatedWaitPolicy policy);
+
     /// Trace signals in models within the context; called by application code
     void trace(VerilatedTraceBaseC* tfp, int levels, int options = 0);
     /// Allow traces to at some point be enabled (disables some optimizations)
@@ -28,6 +28,8 @@
 #error "verilated_funcs.h should only be included by verilated.h"
 #endif
 
+#include "verilated_intrinsics.h"
+
 #include <string>
 
 //=========================================================================
@@ -2045,6 +2047,137 @@ static inline QData VL_SHIFTR_QQW(int obits, int, int rbits, QData lhs,
     return VL_SHIFTR_QQI(obits, obits, 32, lhs, rwp[0]);
 }
 
+//=========================================================================
+// Wide operators with a fixed word count
+//
+// Emitted in place of the above VL_*_W functions (unless -fno-wide-simd).
+// The constant trip counts let the C++ compiler unroll and vectorize the
+// loops, and with AVX2 the bulk of the words use the verilated_intrinsics.h
+// kernels. Results are identical to the variable word count functions.
+
+template <std::size_t N_Words>
+static inline WDataOutP VL_AND_W(WDataOutP owp, WDataInP const lwp,
+                                 WDataInP const rwp) VL_MT_SAFE {
+    std::size_t i = 0;
+#ifdef VL_HAVE_AVX2
+    if (N_Words >= 8) {
+        _vl_avx2_and_w(N_Words, owp, lwp, rwp);
+        i = N_Words & ~7;
+    }
+#endif
+    for (; i < N_Words; ++i) owp[i] = (lwp[i] & rwp[i]);
+    return owp;
+}
+template <std::size_t N_Words>
+static inline WDataOutP VL_OR_W(WDataOutP owp, WDataInP const lwp, WDataInP const rwp) VL_MT_SAFE {
+    std::size_t i = 0;
+#ifdef VL_HAVE_AVX2
+    if (N_Words >= 8) {
+        _vl_avx2_or_w(N_Words, owp, lwp, rwp);
+        i = N_Words & ~7;
+    }
+#endif
+    for (; i < N_Words; ++i) owp[i] = (lwp[i] | rwp[i]);
+    return owp;
+}
+template <std::size_t N_Words>
+static inline WDataOutP VL_XOR_W(WDataOutP owp, WDataInP const lwp,
+                                 WDataInP const rwp) VL_MT_SAFE {
+    std::size_t i = 0;
+#ifdef VL_HAVE_AVX2
+    if (N_Words >= 8) {
+        _vl_avx2_xor_w(N_Words, owp, lwp, rwp);
+        i = N_Words & ~7;
+    }
+#endif
+    for (; i < N_Words; ++i) owp[i] = (lwp[i] ^ rwp[i]);
+    return owp;
+}
+template <std::size_t N_Words>
+static inline WDataOutP VL_NOT_W(WDataOutP owp, WDataInP const lwp) VL_MT_SAFE {
+    std::size_t i = 0;
+#ifdef VL_HAVE_AVX2
+    if (N_Words >= 8) {
+        _vl_avx2_not_w(N_Words, owp, lwp);
+        i = N_Words & ~7;
+    }
+#endif
+    for (; i < N_Words; ++i) owp[i] = ~(lwp[i]);
+    return owp;
+}
+// Output clean, <lhs> AND <rhs> MUST BE CLEAN
+template <std::size_t N_Words>
+static inline IData VL_EQ_W(WDataInP const lwp, WDataInP const rwp) VL_PURE {
+    std::size_t i = 0;
+    EData nequal = 0;
+#ifdef VL_HAVE_AVX2
+    if (N_Words >= 8) {
+        if (_vl_avx2_neq_w(N_Words, lwp, rwp)) return 0;
+        i = N_Words & ~7;
+    }
+#endif
+    for (; i < N_Words; ++i) nequal |= (lwp[i] ^ rwp[i]);
+    return (nequal == 0);
+}
+// As VL_SHIFTL_WWI, where N_Words == VL_WORDS_I(obits)
+template <std::size_t N_Words>
+static inline WDataOutP VL_SHIFTL_W(int obits, WDataOutP owp, WDataInP const lwp,
+                                    IData rd) VL_MT_SAFE {
+    if (rd >= static_cast<IData>(obits)) {  // rd may be huge with MSB set
+        for (std::size_t i = 0; i < N_Words; ++i) owp[i] = 0;
+        return owp;
+    }
+    const std::size_t word_shift = VL_BITWORD_E(rd);
+    const int bit_shift = VL_BITBIT_E(rd);
+    for (std::size_t i = 0; i < word_shift; ++i) owp[i] = 0;
+    if (bit_shift == 0) {  // Aligned word shift (<<0,<<32,<<64 etc)
+        for (std::size_t i = word_shift; i < N_Words; ++i) owp[i] = lwp[i - word_shift];
+        return owp;
+    }
+    owp[word_shift] = lwp[0] << bit_shift;
+    std::size_t i = word_shift + 1;
+#ifdef VL_HAVE_AVX2
+    if (N_Words > 8) i += _vl_avx2_funnel_w(N_Words - i, owp + i, lwp + 1, lwp, bit_shift);
+#endif
+    for (; i < N_Words; ++i) {
+        owp[i] = (lwp[i - word_shift] << bit_shift)
+                 | (lwp[i - word_shift - 1] >> (VL_EDATASIZE - bit_shift));
+    }
+    owp[N_Words - 1] &= VL_MASK_E(obits);
+    return owp;
+}
+// As VL_SHIFTR_WWI, where N_Words == VL_WORDS_I(obits)
+template <std::size_t N_Words>
+static inline WDataOutP VL_SHIFTR_W(int obits, WDataOutP owp, WDataInP const lwp,
+                                    IData rd) VL_MT_SAFE {
+    if (rd >= static_cast<IData>(obits)) {  // rd may be huge with MSB set
+        for (std::size_t i = 0; i < N_Words; ++i) owp[i] = 0;
+        return owp;
+    }
+    const std::size_t word_shift = VL_BITWORD_E(rd);  // Maybe 0
+    const int bit_shift = VL_BITBIT_E(rd);
+    std::size_t i = 0;
+    if (bit_shift == 0) {  // Aligned word shift (>>0,>>32,>>64 etc)
+        for (; i < N_Words - word_shift; ++i) owp[i] = lwp[i + word_shift];
+    } else {
+        const std::size_t words = VL_WORDS_I(obits - rd);
+#ifdef VL_HAVE_AVX2
+        // The last word may have no word above it, so is left to the loop below
+        if (N_Words > 8) {
+            i = _vl_avx2_funnel_w(words - 1, owp, lwp + word_shift + 1, lwp + word_shift,
+                                  VL_EDATASIZE - bit_shift);
+        }
+#endif
+        for (; i < words; ++i) {
+            owp[i] = lwp[i + word_shift] >> bit_shift;
+            const std::size_t upperword = i + word_shift + 1;
+            if (upperword < N_Words) owp[i] |= lwp[upperword] << (VL_EDATASIZE - bit_shift);
+        }
+    }
+    for (; i < N_Words; ++i) owp[i] = 0;
+    return owp;
+}
+
 // EMIT_RULE: VL_SHIFTRS:  oclean=false; lclean=clean, rclean==clean;
 static inline IData VL_SHIFTRS_III(int obits, int lbits, int, IData lhs, IData rhs) VL_PURE {
     // Note the C standard does not specify the >> operator as a arithmetic shift!
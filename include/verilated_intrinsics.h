@@ -42,4 +42,66 @@
 
 // clang-format on
 
+//=========================================================================
+// Kernels over wide (multi-word) values, used by the fixed word count
+// VL_*_W<N> functions in verilated_funcs.h. Each handles the leading multiple
+// of 8 words, and the caller loops over any remaining words.
+
+#ifdef VL_HAVE_AVX2
+#define VL_AVX2_LOAD_(p) _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p))
+#define VL_AVX2_STORE_(p, v) _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), (v))
+
+static inline void _vl_avx2_and_w(size_t words, uint32_t* owp, const uint32_t* lwp,
+                                  const uint32_t* rwp) {
+    for (size_t i = 0; i + 8 <= words; i += 8) {
+        VL_AVX2_STORE_(owp + i, _mm256_and_si256(VL_AVX2_LOAD_(lwp + i), VL_AVX2_LOAD_(rwp + i)));
+    }
+}
+static inline void _vl_avx2_or_w(size_t words, uint32_t* owp, const uint32_t* lwp,
+                                 const uint32_t* rwp) {
+    for (size_t i = 0; i + 8 <= words; i += 8) {
+        VL_AVX2_STORE_(owp + i, _mm256_or_si256(VL_AVX2_LOAD_(lwp + i), VL_AVX2_LOAD_(rwp + i)));
+    }
+}
+static inline void _vl_avx2_xor_w(size_t words, uint32_t* owp, const uint32_t* lwp,
+                                  const uint32_t* rwp) {
+    for (size_t i = 0; i + 8 <= words; i += 8) {
+        VL_AVX2_STORE_(owp + i, _mm256_xor_si256(VL_AVX2_LOAD_(lwp + i), VL_AVX2_LOAD_(rwp + i)));
+    }
+}
+static inline void _vl_avx2_not_w(size_t words, uint32_t* owp, const uint32_t* lwp) {
+    const __m256i ones = _mm256_set1_epi32(-1);
+    for (size_t i = 0; i + 8 <= words; i += 8) {
+        VL_AVX2_STORE_(owp + i, _mm256_xor_si256(VL_AVX2_LOAD_(lwp + i), ones));
+    }
+}
+// Return true if any of the words differ
+static inline bool _vl_avx2_neq_w(size_t words, const uint32_t* lwp, const uint32_t* rwp) {
+    __m256i diff = _mm256_setzero_si256();
+    for (size_t i = 0; i + 8 <= words; i += 8) {
+        diff = _mm256_or_si256(diff,
+                               _mm256_xor_si256(VL_AVX2_LOAD_(lwp + i), VL_AVX2_LOAD_(rwp + i)));
+    }
+    return !_mm256_testz_si256(diff, diff);
+}
+// owp[i] = (hiwp[i] << shift) | (lowp[i] >> (32 - shift)), for 0 < shift < 32.
+// This is the inner loop of both left and right shifts by a non-word amount.
+// Returns the number of words written.
+static inline size_t _vl_avx2_funnel_w(size_t words, uint32_t* owp, const uint32_t* hiwp,
+                                       const uint32_t* lowp, int shift) {
+    const __m128i hiShift = _mm_cvtsi32_si128(shift);
+    const __m128i loShift = _mm_cvtsi32_si128(32 - shift);
+    size_t i = 0;
+    for (; i + 8 <= words; i += 8) {
+        const __m256i hi = _mm256_sll_epi32(VL_AVX2_LOAD_(hiwp + i), hiShift);
+        const __m256i lo = _mm256_srl_epi32(VL_AVX2_LOAD_(lowp + i), loShift);
+        VL_AVX2_STORE_(owp + i, _mm256_or_si256(hi, lo));
+    }
+    return i;
+}
+
+#undef VL_AVX2_LOAD_
+#undef VL_AVX2_STORE_
+#endif
+
 #endif  // Guard
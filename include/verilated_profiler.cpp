@@ -145,10 +145,9 @@ void VlExecutionProfiler::dump(const char* filenamep, uint64_t tickEnd)
     fprintf(fp, "VLPROF arg +verilator+prof+exec+window+%u\n",
             Verilated::threadContextp()->profExecWindow());
     std::string numa = "no threads";
-    if (const VlThreadPool* const threadPoolp
-        = static_cast<VlThreadPool*>(Verilated::threadContextp()->threadPoolp())) {
-        numa = threadPoolp->numaStatus();
-    }
+    VlThreadPool* const threadPoolp
+        = static_cast<VlThreadPool*>(Verilated::threadContextp()->threadPoolp());
+    if (threadPoolp) numa = threadPoolp->numaStatus();
     fprintf(fp, "VLPROF info numa %s\n", numa.c_str());
     // Note that VerilatedContext will by default create as many threads as there are hardware
     // processors, but not all of them might be utilized. Report the actual number that has trace
@@ -159,6 +158,20 @@ void VlExecutionProfiler::dump(const char* filenamep, uint64_t tickEnd)
     }
     fprintf(fp, "VLPROF stat threads %u\n", threads);
     fprintf(fp, "VLPROF stat yields %" PRIu64 "\n", VlMTaskVertex::yields());
+    if (threadPoolp) {
+        static const char* const policyNames[] = {"spin", "adaptive", "block"};
+        fprintf(fp, "VLPROF info wait_policy %s\n",
+                policyNames[static_cast<int>(threadPoolp->waitPolicy())]);
+        // Time spent waiting for mtask dependencies, per worker, then by other threads
+        const auto writeWaitStats = [fp](const std::string& name, const VlWaitStats& stats) {
+            fprintf(fp, "VLPROF stat wait_%s %" PRIu64 ",%" PRIu64 ",%" PRIu64 "\n",
+                    name.c_str(), stats.waits(), stats.sleeps(), stats.waitNs());
+        };
+        for (int i = 0; i < threadPoolp->numThreads(); ++i) {
+            writeWaitStats(std::to_string(i), threadPoolp->workerp(i)->waitStats());
+        }
+        writeWaitStats("main", threadPoolp->mainWaitStats());
+    }
 
     // Copy /proc/cpuinfo into this output so verilator_gantt can be run on
     // a different machine
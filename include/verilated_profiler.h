@@ -209,7 +209,7 @@ public:
 //=============================================================================
 // VlPgoProfiler is for collecting profiling data for PGO
 
-template <std::size_t N_Entries>
+template <std::size_t N_Entries, std::size_t N_Events = 0>
 class VlPgoProfiler final {
     // TYPES
     struct Record final {
@@ -220,6 +220,10 @@ class VlPgoProfiler final {
     // Counters are stored packed, all together to reduce cache effects
     std::array<uint64_t, N_Entries> m_counters{};  // Time spent on this record
     std::vector<Record> m_records;  // Record information
+    // Number of times each branch was taken, or each function called
+    std::array<std::atomic<uint64_t>, N_Events> m_eventCounters{};
+    std::vector<Record> m_branchRecords;  // Branch record information
+    std::vector<Record> m_functionRecords;  // Function record information
     // An original cost of a profiled hier block. During Verilation with
     // collected profiling data, costs of hier blocks change thus hashes of
     // original mtasks does not match those from the previous,
@@ -248,10 +252,22 @@ public:
         m_counters[counter] -= VL_CPU_TICK();
     }
     void stopCounter(size_t counter) { m_counters[counter] += VL_CPU_TICK(); }
+    void addBranchCounter(size_t counter, const std::string& name) {
+        VL_DEBUG_IF(assert(counter < N_Events););
+        m_branchRecords.emplace_back(Record{name, counter});
+    }
+    void addFunctionCounter(size_t counter, const std::string& name) {
+        VL_DEBUG_IF(assert(counter < N_Events););
+        m_functionRecords.emplace_back(Record{name, counter});
+    }
+    // Relaxed, as the counts are only read once the model is finished
+    void countEvent(size_t counter) {
+        m_eventCounters[counter].fetch_add(1, std::memory_order_relaxed);
+    }
 };
 
-template <std::size_t N_Entries>
-void VlPgoProfiler<N_Entries>::writeHeader(const std::string& filename) VL_MT_SAFE {
+template <std::size_t N_Entries, std::size_t N_Events>
+void VlPgoProfiler<N_Entries, N_Events>::writeHeader(const std::string& filename) VL_MT_SAFE {
     static VerilatedMutex s_mutex;
     const VerilatedLockGuard lock{s_mutex};
 
@@ -277,8 +293,9 @@ void VlPgoProfiler<N_Entries>::writeHeader(const std::string& filename) VL_MT_SA
     std::fclose(fp);
 }
 
-template <std::size_t N_Entries>
-void VlPgoProfiler<N_Entries>::write(const char* modelp, const std::string& filename) VL_MT_SAFE {
+template <std::size_t N_Entries, std::size_t N_Events>
+void VlPgoProfiler<N_Entries, N_Events>::write(const char* modelp,
+                                                 const std::string& filename) VL_MT_SAFE {
     static VerilatedMutex s_mutex;
     const VerilatedLockGuard lock{s_mutex};
 
@@ -299,6 +316,18 @@ void VlPgoProfiler<N_Entries>::write(const char* modelp, const std::string& file
                 rec.m_name.c_str(), m_counters[rec.m_counterNumber]);
     }
 
+    for (const Record& rec : m_branchRecords) {
+        fprintf(fp, "profile_data -model \"%s\" -branch \"%s\" -cost 64'd%" PRIu64 "\n", modelp,
+                rec.m_name.c_str(),
+                m_eventCounters[rec.m_counterNumber].load(std::memory_order_relaxed));
+    }
+
+    for (const Record& rec : m_functionRecords) {
+        fprintf(fp, "profile_data -model \"%s\" -function \"%s\" -cost 64'd%" PRIu64 "\n",
+                modelp, rec.m_name.c_str(),
+                m_eventCounters[rec.m_counterNumber].load(std::memory_order_relaxed));
+    }
+
     std::fclose(fp);
 }
 
@@ -25,15 +25,25 @@
 
 #include "verilated_threads.h"
 
+#include <chrono>
+#include <climits>
 #include <cstdio>
+#include <cstdlib>
 #include <fstream>
 #include <iostream>
 #include <memory>
+#include <new>
 #include <string>
 
 #ifdef __FreeBSD__
 #include <pthread_np.h>
 #endif
+#ifdef __linux
+#include <linux/futex.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
 
 //=============================================================================
 // Globals
@@ -42,6 +52,11 @@
 
 std::atomic<uint64_t> VlMTaskVertex::s_yields;
 
+// Wait statistics of the current thread, if it is a pool worker
+static thread_local VlWaitStats* t_waitStatsp = nullptr;
+// ADAPTIVE spin budget of the current thread, if it is not a pool worker
+static thread_local unsigned t_spinBudget = VlWaitStats::s_initialSpinBudget;
+
 //=============================================================================
 // VlMTaskVertex
 
@@ -51,11 +66,34 @@ VlMTaskVertex::VlMTaskVertex(uint32_t upstreamDepCount)
     assert(atomic_is_lock_free(&m_upstreamDepsDone));
 }
 
+void VlMTaskVertex::sleepUntilChanged(bool evenCycle) const {
+    m_sleepers.fetch_add(1);
+    const uint32_t value = m_upstreamDepsDone.load();
+    if (value != (evenCycle ? m_upstreamDepCount : 0)) {
+#if defined(__linux) && defined(SYS_futex)
+        // Returns immediately if the count is no longer 'value'
+        const uint32_t* const wordp = reinterpret_cast<const uint32_t*>(&m_upstreamDepsDone);
+        syscall(SYS_futex, wordp, FUTEX_WAIT_PRIVATE, value, nullptr, nullptr, 0);
+#else
+        yieldThread();
+#endif
+    }
+    m_sleepers.fetch_sub(1);
+}
+
+void VlMTaskVertex::wakeSleepers() {
+#if defined(__linux) && defined(SYS_futex)
+    syscall(SYS_futex, reinterpret_cast<uint32_t*>(&m_upstreamDepsDone), FUTEX_WAKE_PRIVATE,
+            INT_MAX, nullptr, nullptr, 0);
+#endif
+}
+
 //=============================================================================
 // VlWorkerThread
 
-VlWorkerThread::VlWorkerThread(VerilatedContext* contextp)
+VlWorkerThread::VlWorkerThread(VlThreadPool* poolp, VerilatedContext* contextp)
     : m_ready_size{0}
+    , m_poolp{poolp}
     , m_contextp{contextp} {
 #ifdef VL_USE_PTHREADS
     // Init attributes
@@ -109,9 +147,44 @@ void VlWorkerThread::wait() {
     while (!flag.load()) std::this_thread::yield();
 }
 
+template <bool N_SpinWait>
+void VlWorkerThread::dequeWork(ExecRec* workp) VL_MT_SAFE_EXCLUDES(m_mutex) {
+    // Spin for a while, waiting for new data
+    if VL_CONSTEXPR_CXX17 (N_SpinWait) {
+        const VerilatedWaitPolicy policy = m_poolp->waitPolicy();
+        const unsigned spins = policy == VerilatedWaitPolicy::SPIN       ? VL_LOCK_SPINS
+                               : policy == VerilatedWaitPolicy::ADAPTIVE ? m_waitStats.spinBudget()
+                                                                         : 0;
+        for (unsigned i = 0; i < spins; ++i) {
+            if (VL_LIKELY(m_ready_size.load(std::memory_order_relaxed))) break;
+            if (m_poolp->hasSharedTask()) break;
+            VL_CPU_RELAX();
+        }
+    }
+    VerilatedLockGuard lock{m_mutex};
+    while (m_ready.empty()) {
+        // Tasks on this thread's own list take priority over shared tasks.
+        // The shared queue is checked under m_mutex, and addSharedTask
+        // notifies under m_mutex after enqueueing, so no wakeup is lost.
+        if (m_poolp->takeSharedTask(workp)) {
+            m_waiting = false;
+            return;
+        }
+        m_waiting = true;
+        m_cv.wait(m_mutex);
+    }
+    m_waiting = false;
+    // As noted above this is inefficient if our ready list is ever
+    // long (but it shouldn't be)
+    *workp = m_ready.front();
+    m_ready.erase(m_ready.begin());
+    m_ready_size.fetch_sub(1, std::memory_order_relaxed);
+}
+
 void VlWorkerThread::main() {
     // Initialize thread_locals
     Verilated::threadContextp(m_contextp);
+    t_waitStatsp = &m_waitStats;
     // One work item
     ExecRec work;
     // Wait for the first task without spinning, in case the thread is never actually used.
@@ -132,9 +205,10 @@ void* VlWorkerThread::start(void* argp) {
 //=============================================================================
 // VlThreadPool
 
-VlThreadPool::VlThreadPool(VerilatedContext* contextp, unsigned nThreads) {
+VlThreadPool::VlThreadPool(VerilatedContext* contextp, unsigned nThreads)
+    : m_waitPolicy{contextp ? contextp->threadsWaitPolicy() : VerilatedWaitPolicy::SPIN} {
     for (unsigned i = 0; i < nThreads; ++i) {
-        m_workers.push_back(new VlWorkerThread{contextp});
+        m_workers.push_back(new VlWorkerThread{this, contextp});
         m_unassignedWorkers.push(i);
     }
     m_numaStatus = numaAssign(contextp);
@@ -145,6 +219,165 @@ VlThreadPool::~VlThreadPool() {
     for (auto& i : m_workers) delete i;
 }
 
+void VlThreadPool::addSharedTask(VlExecFnp fnp, VlSelfP selfp, bool evenCycle)
+    VL_MT_SAFE_EXCLUDES(m_sharedMutex) {
+    {
+        const VerilatedLockGuard lock{m_sharedMutex};
+        m_sharedReady.emplace_back(fnp, selfp, evenCycle);
+        m_sharedReadySize.fetch_add(1, std::memory_order_relaxed);
+    }
+    // Wake one idle worker, if all are busy the next one to finish will take it
+    for (VlWorkerThread* const workerp : m_workers) {
+        if (workerp->notifyIfWaiting()) break;
+    }
+}
+
+bool VlThreadPool::takeSharedTask(VlWorkerThread::ExecRec* workp)
+    VL_MT_SAFE_EXCLUDES(m_sharedMutex) {
+    if (!hasSharedTask()) return false;
+    const VerilatedLockGuard lock{m_sharedMutex};
+    if (m_sharedReady.empty()) return false;
+    *workp = m_sharedReady.front();
+    m_sharedReady.pop_front();
+    m_sharedReadySize.fetch_sub(1, std::memory_order_relaxed);
+    return true;
+}
+
+VlWaitStats& VlThreadPool::threadWaitStats() {
+    return t_waitStatsp ? *t_waitStatsp : m_mainWaitStats;
+}
+
+void VlThreadPool::helpUntilDone(const VlMTaskVertex& vertex, bool evenCycle) {
+    // Rather than idle, the waiting thread executes ready tasks itself. This
+    // also guarantees progress when the pool has fewer workers than there are
+    // ready tasks, e.g. with several models sharing one VerilatedContext.
+    // With any wait policy the thread only yields, never blocks in the kernel,
+    // as then it could not take tasks added to the shared queue later.
+    if (VL_LIKELY(vertex.areUpstreamDepsDone(evenCycle))) return;
+    using Clock = std::chrono::steady_clock;
+    const Clock::time_point start = Clock::now();
+    Clock::duration helping{0};  // Time spent executing tasks, not waiting
+    VlWorkerThread::ExecRec work;
+    unsigned ct = 0;
+    while (!vertex.areUpstreamDepsDone(evenCycle)) {
+        if (takeSharedTask(&work)) {
+            const Clock::time_point taskStart = Clock::now();
+            work.m_fnp(work.m_selfp, work.m_evenCycle);
+            helping += Clock::now() - taskStart;
+            ct = 0;
+            continue;
+        }
+        VL_CPU_RELAX();
+        if (VL_UNLIKELY(++ct > VL_LOCK_SPINS)) {
+            ct = 0;
+            VlMTaskVertex::yieldThread();
+        }
+    }
+    VlWaitStats& stats = threadWaitStats();
+    VlWaitStats::add(stats.m_waits, 1);
+    VlWaitStats::add(stats.m_waitNs, std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                         Clock::now() - start - helping)
+                                         .count());
+}
+
+void VlThreadPool::waitSlow(const VlMTaskVertex& vertex, bool evenCycle) {
+    using Clock = std::chrono::steady_clock;
+    VlWaitStats& stats = threadWaitStats();
+    unsigned& spinBudget = t_waitStatsp ? t_waitStatsp->m_spinBudget : t_spinBudget;
+    const Clock::time_point start = Clock::now();
+    const VerilatedWaitPolicy policy = waitPolicy();
+    if (policy == VerilatedWaitPolicy::SPIN) {
+        vertex.waitUntilUpstreamDone(evenCycle);
+    } else {
+        // Spin first, for as long as recent waits took, then block
+        const unsigned budget = policy == VerilatedWaitPolicy::ADAPTIVE ? spinBudget : 0;
+        unsigned spins = 0;
+        while (spins < budget && !vertex.areUpstreamDepsDone(evenCycle)) {
+            VL_CPU_RELAX();
+            ++spins;
+        }
+        const Clock::time_point spinEnd = Clock::now();
+        bool slept = false;
+        while (!vertex.areUpstreamDepsDone(evenCycle)) {
+            vertex.sleepUntilChanged(evenCycle);
+            slept = true;
+        }
+        if (slept) VlWaitStats::add(stats.m_sleeps, 1);
+        if (policy == VerilatedWaitPolicy::ADAPTIVE) {
+            // Calibrate: converge on twice the spins needed when spinning
+            // succeeds. When blocking was needed, double the budget if the wait
+            // only just missed, otherwise halve it so long waits don't burn CPU.
+            constexpr unsigned minSpins = 64;
+            unsigned next = spinBudget;
+            if (!slept) {
+                next = (next * 7 + spins * 2) / 8;
+            } else if ((Clock::now() - start) < 2 * (spinEnd - start)) {
+                next *= 2;
+            } else {
+                next /= 2;
+            }
+            spinBudget = std::min<unsigned>(std::max(next, minSpins), VL_LOCK_SPINS);
+        }
+    }
+    VlWaitStats::add(stats.m_waits, 1);
+    VlWaitStats::add(stats.m_waitNs,
+                     std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start)
+                         .count());
+}
+
+std::string VlThreadPool::numaStatus() const {
+    std::string result = m_numaStatus;
+    const uint64_t placed = m_firstTouchPlaced.load();
+    const uint64_t shared = m_firstTouchShared.load();
+    if (placed || shared) {
+        result += "; first touch placed " + std::to_string(placed)
+                  + " bytes on owning workers, " + std::to_string(shared)
+                  + " bytes shared so estimated remote";
+    }
+    return result;
+}
+
+void VlThreadPool::firstTouch(int index, VlExecFnp fnp, VlSelfP selfp, uint64_t bytes) {
+    if (index < numThreads()) {
+        workerp(index)->addTask(fnp, selfp);
+        m_firstTouchPlaced += bytes;
+    } else {
+        // Owned by the thread evaluating the model, which is the current one
+        fnp(selfp, false);
+    }
+}
+
+void VlThreadPool::firstTouchDone(uint64_t sharedBytes) {
+    for (VlWorkerThread* const workerp : m_workers) workerp->wait();
+    m_firstTouchShared += sharedBytes;
+}
+
+void* VlThreadPool::allocModel(size_t size, bool hugePages) {
+#if defined(__linux) || defined(VL_CPPCHECK)
+    // Large allocations are mmapped by the C library, so pages stay
+    // untouched until written. Huge pages are 2MB on common platforms.
+    const size_t align = hugePages ? (static_cast<size_t>(2) << 20) : 4096;
+    const size_t allocSize = (size + align - 1) / align * align;
+    void* ptr = nullptr;
+    if (posix_memalign(&ptr, align, allocSize)) throw std::bad_alloc{};
+#ifdef MADV_HUGEPAGE
+    if (hugePages) madvise(ptr, allocSize, MADV_HUGEPAGE);  // Advisory, so ignore errors
+#endif
+    return ptr;
+#else
+    (void)hugePages;
+    return ::operator new(size);
+#endif
+}
+
+void VlThreadPool::freeModel(void* ptr) {
+#if defined(__linux) || defined(VL_CPPCHECK)
+    std::free(ptr);
+#else
+    ::operator delete(ptr);
+#endif
+}
+
 std::string VlThreadPool::numaAssign(VerilatedContext* contextp) {
 #if defined(__linux) || defined(CPU_ZERO) || defined(VL_CPPCHECK)  // Linux-like pthreads
     if (contextp && !contextp->useNumaAssign()) { return "NUMA assignment not requested"; }
@@ -29,6 +29,7 @@
 
 #include <atomic>
 #include <condition_variable>
+#include <deque>
 #include <set>
 #include <stack>
 #include <thread>
@@ -76,6 +77,9 @@ class VlMTaskVertex final {
     // use 16-bit types here...)
     std::atomic<uint32_t> m_upstreamDepsDone;
     const uint32_t m_upstreamDepCount;
+    // Threads blocked in the kernel waiting for this vertex (BLOCK and
+    // ADAPTIVE wait policies)
+    mutable std::atomic<uint32_t> m_sleepers{0};
 
 public:
     // CONSTRUCTORS
@@ -96,17 +100,20 @@ public:
     // Returns true when the current MTaskVertex becomes ready to execute,
     // false while it's still waiting on more dependencies.
     bool signalUpstreamDone(bool evenCycle) {
+        // Sequentially consistent, so either this sees a new sleeper, or the
+        // sleeper sees the new count; see sleepUntilChanged
+        bool ready;
         if (evenCycle) {
-            const uint32_t upstreamDepsDone
-                = 1 + m_upstreamDepsDone.fetch_add(1, std::memory_order_release);
+            const uint32_t upstreamDepsDone = 1 + m_upstreamDepsDone.fetch_add(1);
             assert(upstreamDepsDone <= m_upstreamDepCount);
-            return (upstreamDepsDone == m_upstreamDepCount);
+            ready = (upstreamDepsDone == m_upstreamDepCount);
         } else {
-            const uint32_t upstreamDepsDone_prev
-                = m_upstreamDepsDone.fetch_sub(1, std::memory_order_release);
+            const uint32_t upstreamDepsDone_prev = m_upstreamDepsDone.fetch_sub(1);
             assert(upstreamDepsDone_prev > 0);
-            return (upstreamDepsDone_prev == 1);
+            ready = (upstreamDepsDone_prev == 1);
         }
+        if (ready && VL_UNLIKELY(m_sleepers.load())) wakeSleepers();
+        return ready;
     }
     bool areUpstreamDepsDone(bool evenCycle) const {
         const uint32_t target = evenCycle ? m_upstreamDepCount : 0;
@@ -123,6 +130,40 @@ public:
             }
         }
     }
+    // Block in the kernel until the vertex becomes ready, or spuriously
+    void sleepUntilChanged(bool evenCycle) const;
+
+private:
+    void wakeSleepers();
+};
+
+// Statistics of threads waiting for mtask dependencies. The statistics of
+// threads not in the pool are shared, so counters use atomic adds.
+class VlWaitStats final {
+    friend class VlThreadPool;
+
+public:
+    static constexpr unsigned s_initialSpinBudget = 1024;  // Spin budget before calibration
+
+private:
+    // MEMBERS
+    std::atomic<uint64_t> m_waits{0};  // Waits where the dependency was not ready
+    std::atomic<uint64_t> m_sleeps{0};  // Waits that blocked in the kernel
+    std::atomic<uint64_t> m_waitNs{0};  // Total time spent waiting
+    // Spin count before blocking with the ADAPTIVE policy, calibrated from
+    // recent waits. Only used by the owning worker, other threads have their
+    // own thread local budget.
+    unsigned m_spinBudget = s_initialSpinBudget;
+
+    static void add(std::atomic<uint64_t>& counter, uint64_t value) {
+        counter.fetch_add(value, std::memory_order_relaxed);
+    }
+
+public:
+    uint64_t waits() const { return m_waits.load(std::memory_order_relaxed); }
+    uint64_t sleeps() const { return m_sleeps.load(std::memory_order_relaxed); }
+    uint64_t waitNs() const { return m_waitNs.load(std::memory_order_relaxed); }
+    unsigned spinBudget() const { return m_spinBudget; }
 };
 
 class VlWorkerThread final {
@@ -152,8 +193,12 @@ class VlWorkerThread final {
     std::vector<ExecRec> m_ready VL_GUARDED_BY(m_mutex);
     // Store the size atomically, so we can spin wait
     std::atomic<size_t> m_ready_size;
+    // Pool this worker belongs to, for the shared ready queue
+    VlThreadPool* const m_poolp;
     // Thread context
     VerilatedContext* const m_contextp;
+    // Statistics of waiting for mtask dependencies on this thread
+    VlWaitStats m_waitStats;
     // Underlying thread record
 #ifdef VL_USE_PTHREADS
     pthread_t m_pthread{};
@@ -169,30 +214,23 @@ class VlWorkerThread final {
 
 public:
     // CONSTRUCTORS
-    explicit VlWorkerThread(VerilatedContext* contextp);
+    VlWorkerThread(VlThreadPool* poolp, VerilatedContext* contextp);
     ~VlWorkerThread();
 
     // METHODS
+    // Take the next task from this thread's ready list, or failing that,
+    // from the ready queue shared by the whole pool
     template <bool N_SpinWait>
-    void dequeWork(ExecRec* workp) VL_MT_SAFE_EXCLUDES(m_mutex) {
-        // Spin for a while, waiting for new data
-        if VL_CONSTEXPR_CXX17 (N_SpinWait) {
-            for (unsigned i = 0; i < VL_LOCK_SPINS; ++i) {
-                if (VL_LIKELY(m_ready_size.load(std::memory_order_relaxed))) break;
-                VL_CPU_RELAX();
-            }
-        }
-        VerilatedLockGuard lock{m_mutex};
-        while (m_ready.empty()) {
-            m_waiting = true;
-            m_cv.wait(m_mutex);
+    void dequeWork(ExecRec* workp) VL_MT_SAFE_EXCLUDES(m_mutex);
+    // Wake the thread if it is waiting for work, return true if it was woken
+    bool notifyIfWaiting() VL_MT_SAFE_EXCLUDES(m_mutex) {
+        {
+            const VerilatedLockGuard lock{m_mutex};
+            if (!m_waiting) return false;
+            m_waiting = false;  // So next notification picks another thread
         }
-        m_waiting = false;
-        // As noted above this is inefficient if our ready list is ever
-        // long (but it shouldn't be)
-        *workp = m_ready.front();
-        m_ready.erase(m_ready.begin());
-        m_ready_size.fetch_sub(1, std::memory_order_relaxed);
+        m_cv.notify_one();
+        return true;
     }
     void addTask(VlExecFnp fnp, VlSelfP selfp, bool evenCycle = false)
         VL_MT_SAFE_EXCLUDES(m_mutex) {
@@ -208,6 +246,7 @@ public:
 
     void shutdown();  // Finish current tasks, then terminate thread
     void wait();  // Blocks calling thread until all tasks complete in this thread
+    const VlWaitStats& waitStats() const { return m_waitStats; }
 };
 
 class VlThreadPool final : public VerilatedVirtualBase {
@@ -220,6 +259,20 @@ class VlThreadPool final : public VerilatedVirtualBase {
     // For sequentially generating task IDs to avoid shadowing
     std::atomic<unsigned> m_assignedTasks{0};
     std::string m_numaStatus;  // Status of NUMA assignment
+    // Model state first touched by the worker owning it (--threads-first-touch)
+    std::atomic<uint64_t> m_firstTouchPlaced{0};
+    // Model state accessed by several threads, so remote to some of them
+    std::atomic<uint64_t> m_firstTouchShared{0};
+    // How threads wait for mtask dependencies
+    std::atomic<VerilatedWaitPolicy> m_waitPolicy;
+    // Statistics of waiting on all threads not in the pool, e.g. calling eval
+    VlWaitStats m_mainWaitStats;
+
+    // Ready queue shared by all workers and models (--threads-shared-queue)
+    mutable VerilatedMutex m_sharedMutex;  // Guards m_sharedReady
+    std::deque<VlWorkerThread::ExecRec> m_sharedReady VL_GUARDED_BY(m_sharedMutex);
+    // Store the size atomically, so we can spin wait
+    std::atomic<size_t> m_sharedReadySize{0};
 
 public:
     // CONSTRUCTORS
@@ -244,16 +297,57 @@ public:
     }
     unsigned assignTaskIndex() { return m_assignedTasks++; }
     int numThreads() const { return static_cast<int>(m_workers.size()); }
-    std::string numaStatus() const { return m_numaStatus; }
+    std::string numaStatus() const;
     VlWorkerThread* workerp(int index) {
         assert(index >= 0);
         assert(index < static_cast<int>(m_workers.size()));
         return m_workers[index];
     }
 
+    // Wait until 'vertex' is ready, according to waitPolicy()
+    void waitUntilUpstreamDone(const VlMTaskVertex& vertex, bool evenCycle) {
+        if (VL_LIKELY(vertex.areUpstreamDepsDone(evenCycle))) return;
+        waitSlow(vertex, evenCycle);
+    }
+    VerilatedWaitPolicy waitPolicy() const {
+        return m_waitPolicy.load(std::memory_order_relaxed);
+    }
+    void waitPolicy(VerilatedWaitPolicy policy) {
+        m_waitPolicy.store(policy, std::memory_order_relaxed);
+    }
+    const VlWaitStats& mainWaitStats() const { return m_mainWaitStats; }
+
+    // Shared ready queue. Any idle worker, or any thread waiting in
+    // helpUntilDone, may execute tasks added here. Tasks must not block
+    // waiting for other tasks.
+    void addSharedTask(VlExecFnp fnp, VlSelfP selfp, bool evenCycle)
+        VL_MT_SAFE_EXCLUDES(m_sharedMutex);
+    bool hasSharedTask() const {
+        return m_sharedReadySize.load(std::memory_order_relaxed) != 0;
+    }
+    // Remove a task from the shared queue, return false if there was none
+    bool takeSharedTask(VlWorkerThread::ExecRec* workp) VL_MT_SAFE_EXCLUDES(m_sharedMutex);
+    // Execute tasks from the shared queue until 'vertex' becomes ready
+    void helpUntilDone(const VlMTaskVertex& vertex, bool evenCycle);
+
+    // NUMA placement of model state (--threads-first-touch). Run 'fnp' on
+    // worker 'index' to initialize the 'bytes' of state only that worker writes,
+    // so its pages are allocated on the worker's node.
+    void firstTouch(int index, VlExecFnp fnp, VlSelfP selfp, uint64_t bytes);
+    // Wait for all firstTouch tasks. 'sharedBytes' is state written by several threads.
+    void firstTouchDone(uint64_t sharedBytes);
+    // Allocate model state page aligned and untouched, so that its pages are
+    // placed by first touch, optionally advising huge pages (--threads-huge-pages)
+    static void* allocModel(size_t size, bool hugePages);
+    static void freeModel(void* ptr);
+
 private:
     VL_UNCOPYABLE(VlThreadPool);
 
+    void waitSlow(const VlMTaskVertex& vertex, bool evenCycle);
+    // Statistics of the calling thread
+    VlWaitStats& threadWaitStats();
+
     std::string numaAssign(VerilatedContext* contextp);
 };
 
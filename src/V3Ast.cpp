@@ -16,6 +16,7 @@
 
 #include "V3PchAstMT.h"
 
+#include "V3AstArena.h"
 #include "V3Broken.h"
 #include "V3File.h"
 
@@ -990,6 +991,13 @@ void AstNode::operator delete(void* objp, size_t size) {
     V3Broken::deleted(nodep);
     ::operator delete(objp);
 }
+#else
+void* AstNode::operator new(size_t size) { return V3AstArena::allocate(size); }
+
+void AstNode::operator delete(void* objp, size_t size) {
+    if (!objp) return;
+    V3AstArena::deallocate(objp, size);
+}
 #endif
 
 //======================================================================
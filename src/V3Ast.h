@@ -560,10 +560,9 @@ public:
     // Perform a function on every link in a node
     virtual void foreachLink(std::function<void(AstNode** linkpp, const char* namep)> f) = 0;
 
-#ifdef VL_LEAK_CHECKS
+    // Allocated from V3AstArena, or with VL_LEAK_CHECKS tracked by V3Broken
     static void* operator new(size_t size);
     static void operator delete(void* obj, size_t size);
-#endif
 
     // CONSTANTS
     // The following are relative dynamic costs (~ execution cycle count) of various operations.
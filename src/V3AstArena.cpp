@@ -0,0 +1,328 @@
+// -*- mode: C++; c-file-style: "cc-mode" -*-
+//*************************************************************************
+// DESCRIPTION: Verilator: Arena allocator for AstNode
+//
+// Code available from: https://verilator.org
+//
+//*************************************************************************
+//
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of either the GNU Lesser General Public License Version 3
+// or the Perl Artistic License Version 2.0.
+// SPDX-FileCopyrightText: 2003-2026 Wilson Snyder
+// SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+//
+//*************************************************************************
+// V3AstArena's Transformations:
+//
+//      Each thread owns a cache holding, per 8 byte size class:
+//          - The slab currently being bump allocated from
+//          - An intrusive free list of deleted nodes of that size
+//      Allocation pops the free list, else bumps, else takes a new slab.
+//      Deletion pushes onto the deleting thread's free list, so nodes
+//      allocated on one thread and deleted on another are still reused.
+//
+//      Compaction (after big deletion passes):
+//          Count the free entries in every slab
+//          Release slabs where every carved node is free
+//          Rebuild the free lists in address order
+//
+//      Nodes are never moved, as passes hold raw node pointers (user
+//      pointers, maps, etc); compaction hence only returns whole slabs.
+//
+//*************************************************************************
+
+#include "config_build.h"
+#include "verilatedos.h"
+
+#include "V3AstArena.h"
+
+#include "V3Error.h"
+#include "V3Global.h"
+#include "V3Mutex.h"
+#include "V3Os.h"
+#include "V3Stats.h"
+
+#include <algorithm>
+#include <atomic>
+#include <new>
+#include <vector>
+
+VL_DEFINE_DEBUG_FUNCTIONS;
+
+namespace {
+
+constexpr size_t SLAB_BYTES = 64 * 1024;  // Bytes in each slab
+constexpr size_t GRANULE_BYTES = 8;  // Size class granularity
+constexpr size_t MAX_SMALL_BYTES = 1024;  // Larger objects use the normal heap
+constexpr size_t NUM_CLASSES = MAX_SMALL_BYTES / GRANULE_BYTES + 1;
+// Compact when at least this much is free, and it is a quarter of the arena
+constexpr size_t COMPACT_MIN_FREE_BYTES = 64 * 1024 * 1024;
+
+struct ArenaFree final {
+    ArenaFree* m_nextp;
+};
+
+class ArenaCache final {
+public:
+    // MEMBERS
+    // Each only written by the owning thread, or by compact() when no
+    // thread is allocating
+    ArenaFree* m_freeps[NUM_CLASSES] = {};  // Free list per size class
+    uint8_t* m_slabps[NUM_CLASSES] = {};  // Slab being bump allocated
+    uint8_t* m_curps[NUM_CLASSES] = {};  // Next bump allocation
+    uint8_t* m_endps[NUM_CLASSES] = {};  // End of bump allocatable region
+    // Read by other threads for statistics, so atomic, but single writer
+    std::atomic<int64_t> m_allocBytes{0};  // Bytes allocated by this thread
+    std::atomic<int64_t> m_freedBytes{0};  // Bytes freed by this thread
+
+    void addAlloc(size_t size) {
+        m_allocBytes.store(m_allocBytes.load(std::memory_order_relaxed) + size,
+                           std::memory_order_relaxed);
+    }
+    void addFreed(size_t size) {
+        m_freedBytes.store(m_freedBytes.load(std::memory_order_relaxed) + size,
+                           std::memory_order_relaxed);
+    }
+};
+
+class ArenaGlobal final {
+public:
+    // MEMBERS
+    V3Mutex m_mutex;  // Protects below
+    std::vector<ArenaCache*> m_caches VL_GUARDED_BY(m_mutex);  // All thread caches
+    std::vector<uint8_t*> m_slabps VL_GUARDED_BY(m_mutex);  // All slabs
+    std::atomic<size_t> m_slabBytes{0};  // Bytes in slabs
+
+    static ArenaGlobal& s() {
+        // Never destructed, as nodes may be deleted during static destruction
+        static ArenaGlobal* const s_globalp = new ArenaGlobal;
+        return *s_globalp;
+    }
+    ArenaCache* newCache() VL_MT_SAFE_EXCLUDES(m_mutex) {
+        ArenaCache* const cachep = new ArenaCache;
+        const V3LockGuard lock{m_mutex};
+        m_caches.push_back(cachep);
+        return cachep;
+    }
+    uint8_t* newSlab() VL_MT_SAFE_EXCLUDES(m_mutex) {
+        uint8_t* const slabp = static_cast<uint8_t*>(::operator new(SLAB_BYTES));
+        const V3LockGuard lock{m_mutex};
+        m_slabps.push_back(slabp);
+        m_slabBytes.fetch_add(SLAB_BYTES, std::memory_order_relaxed);
+        return slabp;
+    }
+};
+
+ArenaCache* threadCache() {
+    static thread_local ArenaCache* t_cachep = nullptr;
+    if (VL_UNLIKELY(!t_cachep)) t_cachep = ArenaGlobal::s().newCache();
+    return t_cachep;
+}
+
+}  // namespace
+
+//######################################################################
+// V3AstArena
+
+void* V3AstArena::allocate(size_t size) {
+    const size_t classNum = (size + GRANULE_BYTES - 1) / GRANULE_BYTES;
+    const size_t classBytes = classNum * GRANULE_BYTES;
+    if (VL_UNLIKELY(classBytes > MAX_SMALL_BYTES)) return ::operator new(size);
+    ArenaCache* const cachep = threadCache();
+    cachep->addAlloc(classBytes);
+    if (ArenaFree* const freep = cachep->m_freeps[classNum]) {
+        cachep->m_freeps[classNum] = freep->m_nextp;
+        return freep;
+    }
+    if (VL_UNLIKELY(cachep->m_curps[classNum] + classBytes > cachep->m_endps[classNum])) {
+        uint8_t* const slabp = ArenaGlobal::s().newSlab();
+        cachep->m_slabps[classNum] = slabp;
+        cachep->m_curps[classNum] = slabp;
+        cachep->m_endps[classNum] = slabp + SLAB_BYTES;
+    }
+    void* const objp = cachep->m_curps[classNum];
+    cachep->m_curps[classNum] += classBytes;
+    return objp;
+}
+
+void V3AstArena::deallocate(void* objp, size_t size) {
+    const size_t classNum = (size + GRANULE_BYTES - 1) / GRANULE_BYTES;
+    const size_t classBytes = classNum * GRANULE_BYTES;
+    if (VL_UNLIKELY(classBytes > MAX_SMALL_BYTES)) {
+        ::operator delete(objp);
+        return;
+    }
+    ArenaCache* const cachep = threadCache();
+    cachep->addFreed(classBytes);
+    ArenaFree* const freep = static_cast<ArenaFree*>(objp);
+    freep->m_nextp = cachep->m_freeps[classNum];
+    cachep->m_freeps[classNum] = freep;
+}
+
+size_t V3AstArena::bytesReserved() {
+    return ArenaGlobal::s().m_slabBytes.load(std::memory_order_relaxed);
+}
+
+size_t V3AstArena::bytesInUse() {
+    ArenaGlobal& global = ArenaGlobal::s();
+    const V3LockGuard lock{global.m_mutex};
+    int64_t bytes = 0;
+    for (const ArenaCache* const cachep : global.m_caches) {
+        bytes += cachep->m_allocBytes.load(std::memory_order_relaxed);
+        bytes -= cachep->m_freedBytes.load(std::memory_order_relaxed);
+    }
+    return bytes > 0 ? static_cast<size_t>(bytes) : 0;
+}
+
+void V3AstArena::compact() {
+    const uint64_t startUsecs = V3Os::timeUsecs();
+    ArenaCache* const ownCachep = threadCache();  // Before lock, as may register
+    ArenaGlobal& global = ArenaGlobal::s();
+    const V3LockGuard lock{global.m_mutex};
+
+    struct SlabInfo final {
+        uint8_t* m_basep;  // Start of slab
+        size_t m_carved = 0;  // Nodes bump allocated from slab
+        size_t m_freed = 0;  // Nodes on free lists
+        bool m_current = false;  // Being bump allocated from, so keep
+        explicit SlabInfo(uint8_t* basep)
+            : m_basep{basep} {}
+        bool operator<(const SlabInfo& rhs) const { return m_basep < rhs.m_basep; }
+    };
+    std::vector<SlabInfo> slabs;
+    slabs.reserve(global.m_slabps.size());
+    for (uint8_t* const slabp : global.m_slabps) slabs.emplace_back(slabp);
+    std::sort(slabs.begin(), slabs.end());
+    const auto findSlab = [&](const void* objp) -> SlabInfo& {
+        const uint8_t* const bytep = static_cast<const uint8_t*>(objp);
+        auto it = std::upper_bound(
+            slabs.begin(), slabs.end(), bytep,
+            [](const uint8_t* p, const SlabInfo& slab) { return p < slab.m_basep; });
+        UASSERT(it != slabs.begin(), "Free node not in any arena slab");
+        --it;
+        UASSERT(bytep < it->m_basep + SLAB_BYTES, "Free node not in any arena slab");
+        return *it;
+    };
+
+    // Slabs are only ever handed to a single size class, so the number of
+    // nodes carved is either all that fit, or up to the bump pointer
+    for (ArenaCache* const cachep : global.m_caches) {
+        for (size_t classNum = 1; classNum < NUM_CLASSES; ++classNum) {
+            if (uint8_t* const slabp = cachep->m_slabps[classNum]) {
+                SlabInfo& slab = findSlab(slabp);
+                slab.m_current = true;
+                slab.m_carved = (cachep->m_curps[classNum] - slabp) / (classNum * GRANULE_BYTES);
+            }
+        }
+    }
+    for (ArenaCache* const cachep : global.m_caches) {
+        for (size_t classNum = 1; classNum < NUM_CLASSES; ++classNum) {
+            for (ArenaFree* freep = cachep->m_freeps[classNum]; freep; freep = freep->m_nextp) {
+                SlabInfo& slab = findSlab(freep);
+                if (!slab.m_current) slab.m_carved = SLAB_BYTES / (classNum * GRANULE_BYTES);
+                ++slab.m_freed;
+            }
+        }
+    }
+
+    // Release slabs holding no live nodes
+    std::vector<uint8_t*> keptSlabps;
+    keptSlabps.reserve(slabs.size());
+    size_t releasedBytes = 0;
+    for (SlabInfo& slab : slabs) {
+        if (!slab.m_current && slab.m_freed && slab.m_freed == slab.m_carved) {
+            slab.m_carved = 0;  // Mark as released
+            releasedBytes += SLAB_BYTES;
+        } else {
+            keptSlabps.push_back(slab.m_basep);
+            slab.m_carved = 1;
+        }
+    }
+
+    // Rebuild free lists in address order, excluding released slabs, and
+    // gather them all onto the compacting thread, which is the one that
+    // builds most nodes, so nodes freed by worker threads get reused.
+    // Released slabs must be freed only after, as the lists thread through them.
+    std::vector<ArenaFree*> entries;
+    for (size_t classNum = 1; classNum < NUM_CLASSES; ++classNum) {
+        entries.clear();
+        for (ArenaCache* const cachep : global.m_caches) {
+            for (ArenaFree* freep = cachep->m_freeps[classNum]; freep; freep = freep->m_nextp) {
+                if (findSlab(freep).m_carved) entries.push_back(freep);
+            }
+            cachep->m_freeps[classNum] = nullptr;
+        }
+        std::sort(entries.begin(), entries.end());
+        ArenaFree* headp = nullptr;
+        for (auto it = entries.rbegin(); it != entries.rend(); ++it) {
+            (*it)->m_nextp = headp;
+            headp = *it;
+        }
+        ownCachep->m_freeps[classNum] = headp;
+    }
+    for (const SlabInfo& slab : slabs) {
+        if (!slab.m_carved) ::operator delete(slab.m_basep);
+    }
+    global.m_slabps.swap(keptSlabps);
+    global.m_slabBytes.fetch_sub(releasedBytes, std::memory_order_relaxed);
+
+    const double elapsed = (V3Os::timeUsecs() - startUsecs) / 1.0e6;
+    UINFO(4, "AST arena compacted, released " << releasedBytes << " bytes in " << elapsed
+                                               << " sec");
+    V3Stats::addStatSum("AST arena, Compactions", 1);
+    V3Stats::addStatSum("AST arena, Compaction released (MB)",
+                        releasedBytes / 1024.0 / 1024.0);
+    V3Stats::addStatPerf("AST arena, Compaction time (sec)", elapsed);
+}
+
+void V3AstArena::compactIfFragmented() {
+    const size_t reserved = bytesReserved();
+    const size_t inUse = bytesInUse();
+    if (inUse >= reserved) return;
+    const size_t freeBytes = reserved - inUse;
+    if (freeBytes >= COMPACT_MIN_FREE_BYTES && freeBytes * 4 >= reserved) compact();
+}
+
+//######################################################################
+// Self test
+
+void V3AstArena::selfTest() {
+    // Runs before any passes, but nodes may exist, so use a size class no
+    // node uses, and only check relative changes in the arena
+    constexpr size_t testBytes = MAX_SMALL_BYTES - GRANULE_BYTES;
+    constexpr size_t perSlab = SLAB_BYTES / testBytes;
+    const size_t inUseBefore = bytesInUse();
+    std::vector<void*> objps;
+    for (size_t i = 0; i < 4 * perSlab; ++i) objps.push_back(allocate(testBytes));
+    UASSERT_SELFTEST(size_t, bytesInUse() - inUseBefore, 4 * perSlab * testBytes);
+    // Bump allocation is dense
+    UASSERT_SELFTEST(ptrdiff_t,
+                     static_cast<uint8_t*>(objps[1]) - static_cast<uint8_t*>(objps[0]),
+                     static_cast<ptrdiff_t>(testBytes));
+    // Reuse what was freed, last in first out
+    void* const lastp = objps.back();
+    deallocate(lastp, testBytes);
+    void* const reusedp = allocate(testBytes);
+    UASSERT_SELFTEST(const void*, reusedp, lastp);
+    // Objects rounded up to a size class share it
+    deallocate(reusedp, testBytes);
+    void* const roundedp = allocate(testBytes - 3);
+    UASSERT_SELFTEST(const void*, roundedp, lastp);
+    // Large objects go to the heap, and are not counted
+    void* const largep = allocate(MAX_SMALL_BYTES + 1);
+    UASSERT_SELFTEST(size_t, bytesInUse() - inUseBefore, 4 * perSlab * testBytes);
+    deallocate(largep, MAX_SMALL_BYTES + 1);
+    // Compaction releases the fully free slabs, but not the current slab
+    const size_t reservedBefore = bytesReserved();
+    for (void* const objp : objps) deallocate(objp, testBytes);
+    UASSERT_SELFTEST(size_t, bytesInUse(), inUseBefore);
+    compact();
+    UASSERT_SELFTEST(size_t, reservedBefore - bytesReserved(), 3 * SLAB_BYTES);
+    // And the free lists remain usable, in address order
+    void* const ap = allocate(testBytes);
+    void* const bp = allocate(testBytes);
+    UASSERT_SELFTEST(bool, ap < bp, true);
+    deallocate(bp, testBytes);
+    deallocate(ap, testBytes);
+}
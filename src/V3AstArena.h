@@ -0,0 +1,50 @@
+// -*- mode: C++; c-file-style: "cc-mode" -*-
+//*************************************************************************
+// DESCRIPTION: Verilator: Arena allocator for AstNode
+//
+// Code available from: https://verilator.org
+//
+//*************************************************************************
+//
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of either the GNU Lesser General Public License Version 3
+// or the Perl Artistic License Version 2.0.
+// SPDX-FileCopyrightText: 2003-2026 Wilson Snyder
+// SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+//
+//*************************************************************************
+
+#ifndef VERILATOR_V3ASTARENA_H_
+#define VERILATOR_V3ASTARENA_H_
+
+#include "config_build.h"
+#include "verilatedos.h"
+
+#include <cstddef>
+
+//============================================================================
+// Nodes are bump allocated from slabs, each slab holding nodes of a single
+// size class. Deleted nodes go onto per-thread size class free lists, and
+// are reused by the next allocation of that size. Nodes created together
+// are thus adjacent in memory, improving locality of tree traversals, and
+// there is no per-allocation heap header.
+
+class V3AstArena final {
+public:
+    static void* allocate(size_t size);
+    static void deallocate(void* objp, size_t size);
+
+    // Release slabs no longer holding any node, and order the free lists by
+    // address so reused memory is dense. Must not be called while other
+    // threads are allocating nodes.
+    static void compact();
+    // Compact if a large part of the arena is free, e.g. after V3Dead
+    static void compactIfFragmented();
+
+    // Statistics
+    static size_t bytesReserved();  // Bytes in slabs
+    static size_t bytesInUse();  // Bytes holding live nodes in slabs
+    static void selfTest();
+};
+
+#endif  // Guard
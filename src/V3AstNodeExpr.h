@@ -228,7 +228,7 @@ class AstNodeFTaskRef VL_NOT_FINAL : public AstNodeExpr {
     // @astgen ptr := m_classOrPackagep : Optional[AstNodeModule]  // Class/package of the task
     ASTGEN_MEMBERS_AstNodeFTaskRef;  // Gen pointers before other members for performance
 private:
-    string m_name;  // Name of variable
+    VInternStr m_name;  // Name of variable
     string m_dotted;  // Dotted part of scope the name()ed task/func is under or ""
     string m_inlinedDots;  // Dotted hierarchy flattened out
     bool m_pli = false;  // Pli system call ($name)
@@ -5802,8 +5802,8 @@ public:
 // === AstNodeVarRef ===
 class AstVarRef final : public AstNodeVarRef {
     // A reference to a variable (lvalue or rvalue)
-    std::string m_name;  // Name of varref, though name() favors varp()->namep()
-                         // if non-null pointer (e.g.: 'this')
+    VInternStr m_name;  // Name of varref, though name() favors varp()->namep()
+                        // if non-null pointer (e.g.: 'this')
 public:
     // This form only allowed post-link because output/wire compression may
     // lead to deletion of AstVar's
@@ -5830,7 +5830,7 @@ public:
 class AstVarXRef final : public AstNodeVarRef {
     // A VarRef to something in another module before AstScope.
     // Includes pin on a cell, as part of a ASSIGN statement to connect I/Os until AstScope
-    string m_name;
+    VInternStr m_name;
     string m_dotted;  // Dotted part of scope the name()'ed reference is under or ""
     string m_inlinedDots;  // Dotted hierarchy flattened out
     bool m_containsGenBlock = false;  // Contains gen block reference
@@ -85,7 +85,7 @@ class AstNodeFTask VL_NOT_FINAL : public AstNode {
     // @astgen op3 := stmtsp : List[AstNode]
     // Scope name
     // @astgen op4 := scopeNamep : Optional[AstScopeName]
-    string m_name;  // Name of task
+    VInternStr m_name;  // Name of task
     string m_cname;  // Name of task if DPI import
     uint64_t m_dpiOpenParent = 0;  // DPI import open array, if !=0, how many callees
     bool m_taskPublic : 1;  // Public task
@@ -263,7 +263,7 @@ class AstNodeModule VL_NOT_FINAL : public AstNode {
     // excluding $unit package stuff
     // @astgen op1 := inlinesp : List[AstNode]
     // @astgen op2 := stmtsp : List[AstNode]
-    string m_name;  // Name of the module
+    VInternStr m_name;  // Name of the module
     const string m_origName;  // Name of the module, ignoring name() changes, for dot lookup
     string m_someInstanceName;  // Hierarchical name of some arbitrary instance of this module.
                                 // Used for user messages only.
@@ -464,7 +464,7 @@ class AstCFunc final : public AstNode {
     // @astgen op3 := stmtsp : List[AstNode]
     //
     // @astgen ptr := m_scopep : Optional[AstScope]  // Scope that function is under
-    string m_name;
+    VInternStr m_name;
     string m_cname;  // C name, for dpiExports
     string m_rtnType;  // void, bool, or other return type
     string m_argTypes;  // Argument types
@@ -639,7 +639,7 @@ class AstCell final : public AstNode {
     //
     // @astgen ptr := m_modp : Optional[AstNodeModule]  // [AfterLink] Pointer to module instanced
     FileLine* m_modNameFileline;  // Where module the cell instances token was
-    string m_name;  // Cell name
+    VInternStr m_name;  // Cell name
     string m_origName;  // Original name before dot addition
     string m_modName;  // Module the cell instances
     bool m_hasIfaceVar : 1;  // True if a Var has been created for this cell
@@ -690,7 +690,7 @@ class AstCellInline final : public AstNode {
     // It is augmented with the scope in V3Scope for VPI.
     // Children: When 2 levels inlined, other CellInline under this
     // @astgen ptr := m_scopep : Optional[AstScope]  // The scope that the cell is inlined into
-    string m_name;  // Cell name, possibly {a}__DOT__{b}...
+    VInternStr m_name;  // Cell name, possibly {a}__DOT__{b}...
     const string m_origModName;  // Original name of module, ignoring name() changes, for LinkDot
 public:
     AstCellInline(FileLine* fl, const string& name, const string& origModName)
@@ -1364,7 +1364,7 @@ class AstPin final : public AstNode {
     // @astgen ptr := m_modVarp : Optional[AstVar]  // Input/output connects to on submodule
     // @astgen ptr := m_modPTypep : Optional[AstParamTypeDType]  // Param type connects to on sub
     int m_pinNum;  // Pin number
-    string m_name;  // Pin name, or "" for number based interconnect
+    VInternStr m_name;  // Pin name, or "" for number based interconnect
     bool m_param = false;  // Pin connects to parameter
     bool m_svDotName = false;  // Pin is SystemVerilog .name'ed
     bool m_svImplicit = false;  // Pin is SystemVerilog .name'ed, allow implicit
@@ -1485,7 +1485,7 @@ class AstScope final : public AstNode {
     // @astgen ptr := m_modp : AstNodeModule  // Module scope corresponds to
 
     // An AstScope->name() is special: . indicates an uninlined scope, __DOT__ an inlined scope
-    string m_name;  // Name
+    VInternStr m_name;  // Name
 public:
     AstScope(FileLine* fl, AstNodeModule* modp, const string& name, AstScope* aboveScopep,
              AstCell* aboveCellp)
@@ -1867,8 +1867,8 @@ class AstVar final : public AstNode {
     // @astgen ptr := m_sensIfacep : Optional[AstIface]  // Interface type to which reads from this
     //                                                      var are sensitive
 
-    string m_name;  // Name of variable
-    string m_origName;  // Original name before dot addition
+    VInternStr m_name;  // Name of variable
+    VInternStr m_origName;  // Original name before dot addition
     string m_tag;  // Holds the string of the verilator tag -- used in JSON output.
     VVarType m_varType;  // Type of variable
     VDirection m_direction;  // Direction input/output etc
@@ -1928,6 +1928,8 @@ class AstVar final : public AstNode {
     bool m_dfgMultidriven : 1;  // Singal is multidriven, used by DFG to avoid repeat processing
     bool m_globalConstrained : 1;  // Global constraint per IEEE 1800-2023 18.5.8
     bool m_isStdRandomizeArg : 1;  // Argument variable created for std::randomize (__Varg*)
+    bool m_cacheLinePad : 1;  // Start on a new cache line to avoid false sharing between threads
+    bool m_sharedParam : 1;  // Parameter turned into a per-instance port by --param-share
     void init() {
         m_ansi = false;
         m_declTyped = false;
@@ -1981,6 +1983,8 @@ class AstVar final : public AstNode {
         m_dfgMultidriven = false;
         m_globalConstrained = false;
         m_isStdRandomizeArg = false;
+        m_cacheLinePad = false;
+        m_sharedParam = false;
     }
 
 public:
@@ -2152,6 +2156,10 @@ public:
     bool globalConstrained() const { return m_globalConstrained; }
     bool isStdRandomizeArg() const { return m_isStdRandomizeArg; }
     void setStdRandomizeArg() { m_isStdRandomizeArg = true; }
+    bool cacheLinePad() const { return m_cacheLinePad; }
+    void setCacheLinePad() { m_cacheLinePad = true; }
+    bool sharedParam() const { return m_sharedParam; }
+    void sharedParam(bool flag) { m_sharedParam = flag; }
     // METHODS
     void name(const string& name) override { m_name = name; }
     void tag(const string& text) override { m_tag = text; }
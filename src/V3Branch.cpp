@@ -20,6 +20,15 @@
 //      At each FTASKREF,
 //         Count calls into the function
 //      Then, if FTASK is called only once, add inline attribute
+//      With --prof-pgo-branch or branch profile data, before CFunc inlining:
+//         Name each IF by its source location, for the profile.
+//      With --prof-pgo-branch, at each IF in a model function:
+//         Count at runtime how often each branch is taken.
+//      With --prof-pgo-branch, at each model function:
+//         Count at runtime how often it is called, for V3InlineCFuncs.
+//      With branch profile data, at each IF:
+//         If one branch is mostly taken, it is likely, overriding the above.
+//         Move large, rarely taken branches into cold functions.
 //
 //*************************************************************************
 
@@ -27,8 +36,27 @@
 
 #include "V3Branch.h"
 
+#include "V3Control.h"
+#include "V3EmitCBase.h"
+#include "V3InstrCount.h"
+#include "V3Stats.h"
+
 VL_DEFINE_DEBUG_FUNCTIONS;
 
+// CONFIG
+// Minimum executions of an IF before its branch profile is trusted
+static constexpr uint64_t BRANCH_PGO_MIN_COUNT = 100;
+// Fraction of executions a branch must take to be likely
+static constexpr double BRANCH_PGO_LIKELY = 0.9;
+// Fraction of executions at or below which a branch is cold
+static constexpr double BRANCH_PGO_COLD = 0.001;
+// Minimum instructions in a cold branch to move it into a cold function
+static constexpr uint32_t BRANCH_PGO_COLD_MIN_INSTRS = 16;
+
+static std::vector<V3Branch::PgoCounter> s_pgoCounters;  // The --prof-pgo-branch counters
+// Profile names of functions, from pgoKeyAll until branchAll
+static std::unordered_map<const AstCFunc*, string> s_pgoFunctionNames;
+
 //######################################################################
 // Branch state, as a visitor of each AstNode
 
@@ -70,11 +98,242 @@ public:
     ~BranchVisitor() override = default;
 };
 
+//######################################################################
+// Branch profile-guided optimization, as a visitor of each AstNode
+
+class BranchPgoVisitor final : public VNVisitor {
+    // NODE STATE
+    //  AstCStmt::user1()   -> bool.  True if a counter added here
+    //  AstCFunc::user1()   -> bool.  True if a cold function created here
+    const VNUser1InUse m_user1InUse;
+
+    // STATE - across all visitors
+    const bool m_instrument = v3Global.opt.profPgoBranch();  // Add branch counters
+    const bool m_useProfile = V3Control::containsBranchProfileData();  // Apply profile data
+    VDouble0 m_statCounters;  // Statistic tracking
+    VDouble0 m_statHints;  // Statistic tracking
+    VDouble0 m_statCold;  // Statistic tracking
+
+    // STATE - for current visit position (use VL_RESTORER)
+    AstNodeModule* m_modp = nullptr;  // Current module
+    AstCFunc* m_cfuncp = nullptr;  // Current function
+    int m_coldNum = 0;  // Cold functions made in this module
+
+    // METHODS
+    bool modelFunction() const {
+        // Function with 'vlSymsp' in scope, so may refer to the profiler
+        return m_cfuncp && m_cfuncp->isLoose() && !m_cfuncp->isStatic()
+               && !VN_IS(m_modp, Class);
+    }
+
+    AstCStmt* newCounter(FileLine* fl, bool function, const string& name) {
+        const size_t counter = s_pgoCounters.size();
+        s_pgoCounters.push_back({function, name});
+        AstCStmt* const stmtp = new AstCStmt{
+            fl, "vlSymsp->_vm_pgoProfiler.countEvent(" + cvtToStr(counter) + ");"};
+        stmtp->user1(true);
+        ++m_statCounters;
+        return stmtp;
+    }
+
+    void addCounter(AstIf* nodep, const string& key, bool thenBranch) {
+        AstCStmt* const stmtp
+            = newCounter(nodep->fileline(), false, key + (thenBranch ? ":then" : ":else"));
+        // At the front, so still counted if the branch jumps out
+        AstNode* const firstp = thenBranch ? nodep->thensp() : nodep->elsesp();
+        if (firstp) {
+            firstp->addHereThisAsNext(stmtp);
+        } else if (thenBranch) {
+            nodep->addThensp(stmtp);
+        } else {
+            nodep->addElsesp(stmtp);
+        }
+    }
+
+    bool coldOutlinable(AstNode* stmtsp) const {
+        if (!stmtsp || !m_cfuncp->scopep()) return false;
+        if (m_cfuncp->needProcess() || m_cfuncp->isCoroutine()) return false;
+        // Must only refer to state reachable through 'vlSelf' and 'vlSymsp',
+        // and must not jump or return out of the branch
+        const bool unsafe = stmtsp->existsAndNext([](const AstNode* nodep) {
+            if (const AstNodeVarRef* const refp = VN_CAST(nodep, NodeVarRef)) {
+                return refp->varp()->isFuncLocal();
+            }
+            if (const AstNodeCCall* const callp = VN_CAST(nodep, NodeCCall)) {
+                return callp->funcp()->needProcess() || callp->funcp()->isCoroutine();
+            }
+            if (VN_IS(nodep, CStmt)) return !nodep->user1();
+            return VN_IS(nodep, CStmtUser) || VN_IS(nodep, CExpr) || VN_IS(nodep, CExprUser)
+                   || VN_IS(nodep, CAwait) || VN_IS(nodep, CReturn) || VN_IS(nodep, JumpGo)
+                   || VN_IS(nodep, LoopTest);
+        });
+        if (unsafe) return false;
+        uint32_t instrs = 0;
+        for (AstNode* nodep = stmtsp; nodep; nodep = nodep->nextp()) {
+            instrs += V3InstrCount::count(nodep, false);
+        }
+        return instrs >= BRANCH_PGO_COLD_MIN_INSTRS;
+    }
+
+    AstNode* createColdFunc(AstNode* stmtsp) {
+        // Move the statements into a new function, returning the call to it
+        FileLine* const fl = stmtsp->fileline();
+        const string name = m_cfuncp->name() + "__cold" + cvtToStr(++m_coldNum);
+        AstCFunc* const funcp = new AstCFunc{fl, name, m_cfuncp->scopep()};
+        funcp->slow(true);  // VL_ATTR_COLD, and emitted with the slow code
+        funcp->isStatic(false);
+        funcp->isLoose(true);
+        funcp->declPrivate(true);
+        funcp->user1(true);
+        funcp->addStmtsp(stmtsp->unlinkFrBackWithNext());
+        m_modp->addStmtsp(funcp);
+        AstCCall* const callp = new AstCCall{fl, funcp};
+        callp->dtypeSetVoid();
+        UINFO(6, "      Cold " << funcp);
+        ++m_statCold;
+        return callp->makeStmt();
+    }
+
+    void applyProfile(AstIf* nodep, const string& key) {
+        const string model = v3Global.opt.prefix();
+        uint64_t thenCount = 0;
+        uint64_t elseCount = 0;
+        if (!V3Control::getBranchProfileData(model, key + ":then", thenCount)) return;
+        if (!V3Control::getBranchProfileData(model, key + ":else", elseCount)) return;
+        const uint64_t total = thenCount + elseCount;
+        UINFO(4, " PGO IF " << key << " then=" << thenCount << " else=" << elseCount);
+        // Never executed IFs are entirely cold
+        const bool known = total >= BRANCH_PGO_MIN_COUNT;
+        const bool thenCold = !total || (known && thenCount <= total * BRANCH_PGO_COLD);
+        const bool elseCold = !total || (known && elseCount <= total * BRANCH_PGO_COLD);
+        if (known) {
+            const VBranchPred pred = thenCount >= total * BRANCH_PGO_LIKELY
+                                         ? VBranchPred{VBranchPred::BP_LIKELY}
+                                     : elseCount >= total * BRANCH_PGO_LIKELY
+                                         ? VBranchPred{VBranchPred::BP_UNLIKELY}
+                                         : VBranchPred{VBranchPred::BP_UNKNOWN};
+            nodep->branchPred(pred);
+            if (!pred.unknown()) ++m_statHints;
+        }
+        if (thenCold && coldOutlinable(nodep->thensp())) {
+            nodep->addThensp(createColdFunc(nodep->thensp()));
+        }
+        if (elseCold && coldOutlinable(nodep->elsesp())) {
+            nodep->addElsesp(createColdFunc(nodep->elsesp()));
+        }
+    }
+
+    // VISITORS
+    void visit(AstNodeModule* nodep) override {
+        VL_RESTORER(m_modp);
+        VL_RESTORER(m_coldNum);
+        m_modp = nodep;
+        m_coldNum = 0;
+        iterateChildren(nodep);
+    }
+    void visit(AstCFunc* nodep) override {
+        if (nodep->user1()) return;  // Cold function made here, already processed
+        VL_RESTORER(m_cfuncp);
+        m_cfuncp = nodep;
+        iterateChildren(nodep);
+        const string& name = V3Branch::pgoFunctionName(nodep);
+        if (m_instrument && modelFunction() && !name.empty()) {
+            AstCStmt* const stmtp = newCounter(nodep->fileline(), true, name);
+            if (nodep->stmtsp()) {
+                nodep->stmtsp()->addHereThisAsNext(stmtp);
+            } else {
+                nodep->addStmtsp(stmtp);
+            }
+        }
+    }
+    void visit(AstIf* nodep) override {
+        // Inner IFs first, so they are moved along with a cold outer branch
+        iterateChildren(nodep);
+        if (!modelFunction()) return;
+        if (nodep->pgoKey().empty()) return;  // Made after pgoKeyAll, so not profiled
+        const string& key = nodep->pgoKey();
+        if (m_useProfile) applyProfile(nodep, key);
+        if (m_instrument) {
+            addCounter(nodep, key, true);
+            addCounter(nodep, key, false);
+        }
+    }
+    void visit(AstNodeExpr*) override {}  // Accelerate
+    void visit(AstVar*) override {}  // Accelerate
+    void visit(AstNode* nodep) override { iterateChildren(nodep); }
+
+public:
+    // CONSTRUCTORS
+    explicit BranchPgoVisitor(AstNetlist* nodep) { iterate(nodep); }
+    ~BranchPgoVisitor() override {
+        V3Stats::addStat("Branch, PGO counters", m_statCounters);
+        V3Stats::addStat("Branch, PGO hints", m_statHints);
+        V3Stats::addStat("Branch, PGO cold functions", m_statCold);
+    }
+};
+
 //######################################################################
 // Branch class functions
 
 void V3Branch::branchAll(AstNetlist* nodep) {
     UINFO(2, __FUNCTION__ << ":");
     { BranchVisitor{nodep}; }
+    s_pgoCounters.clear();
+    if (v3Global.opt.profPgoBranch() || V3Control::containsBranchProfileData()) {
+        BranchPgoVisitor{nodep};
+    }
+    s_pgoFunctionNames.clear();
     V3Global::dumpCheckGlobalTree("branch", 0, dumpTreeEitherLevel() >= 3);
 }
+
+static string pgoLocation(const FileLine* fl) {
+    return fl->filebasename() + ":" + cvtToStr(fl->firstLineno()) + ":"
+           + cvtToStr(fl->firstColumn());
+}
+
+static string pgoBaseName(const string& name) {
+    // Without the '__<n>' suffix making it unique, which shifts as unrelated code changes
+    const size_t pos = name.find_last_not_of("0123456789");
+    if (pos != string::npos && pos >= 1 && pos + 1 < name.size()
+        && name.compare(pos - 1, 2, "__") == 0) {
+        return name.substr(0, pos - 1);
+    }
+    return name;
+}
+
+void V3Branch::pgoKeyAll(AstNetlist* nodep) {
+    UINFO(2, __FUNCTION__ << ":");
+    s_pgoFunctionNames.clear();
+    if (!v3Global.opt.profPgoBranch() && !V3Control::containsBranchProfileData()
+        && !V3Control::containsFunctionProfileData()) {
+        return;
+    }
+    // Identify by source location, so the counts of all instances of a module's IF are
+    // combined. IFs sharing a location, e.g. from unrolling, are numbered in tree order.
+    // This is before V3InlineCFuncs, which differs between the profiling and the
+    // optimizing Verilation, and copies of an IF it inlines share the name.
+    std::unordered_map<string, int> locCounts;  // IFs seen so far at each source location
+    nodep->foreach([&](AstIf* ifp) {
+        const string loc = pgoLocation(ifp->fileline());
+        ifp->pgoKey(loc + ":" + cvtToStr(locCounts[loc]++));
+    });
+    // Functions likewise by module, name without its number, and source location
+    std::unordered_map<string, int> funcCounts;  // Functions seen so far with each name
+    for (AstNode* modp = nodep->modulesp(); modp; modp = modp->nextp()) {
+        for (AstNode* stmtp = VN_AS(modp, NodeModule)->stmtsp(); stmtp; stmtp = stmtp->nextp()) {
+            const AstCFunc* const funcp = VN_CAST(stmtp, CFunc);
+            if (!funcp) continue;
+            const string name = modp->name() + "::" + pgoBaseName(funcp->name()) + "@"
+                                + pgoLocation(funcp->fileline());
+            s_pgoFunctionNames.emplace(funcp, name + ":" + cvtToStr(funcCounts[name]++));
+        }
+    }
+}
+
+const std::vector<V3Branch::PgoCounter>& V3Branch::pgoCounters() { return s_pgoCounters; }
+
+const string& V3Branch::pgoFunctionName(const AstCFunc* funcp) {
+    static const string s_empty;
+    const auto it = s_pgoFunctionNames.find(funcp);
+    return it == s_pgoFunctionNames.end() ? s_empty : it->second;
+}
@@ -20,14 +20,30 @@
 #include "config_build.h"
 #include "verilatedos.h"
 
+#include <string>
+#include <vector>
+
+class AstCFunc;
 class AstNetlist;
 
 //============================================================================
 
 class V3Branch final {
 public:
+    // A --prof-pgo-branch execution counter
+    struct PgoCounter final {
+        bool m_function;  // Counts calls of a function, else times a branch is taken
+        std::string m_name;  // Name in the profile data
+    };
+
     // CONSTRUCTORS
     static void branchAll(AstNetlist* nodep) VL_MT_DISABLED;
+    // Name each IF and function for profiling, before CFunc inlining copies IFs
+    static void pgoKeyAll(AstNetlist* nodep) VL_MT_DISABLED;
+    // The --prof-pgo-branch counters, indexed by counter number
+    static const std::vector<PgoCounter>& pgoCounters() VL_MT_DISABLED;
+    // Name of a function in the profile data, empty if made after pgoKeyAll
+    static const std::string& pgoFunctionName(const AstCFunc* funcp) VL_MT_DISABLED;
 };
 
 #endif  // Guard
@@ -24,9 +24,10 @@
 //                                                  (other items))
 //                                              body
 //              Or, converts to a if/else tree.
+//          Or, if too wide for a table, but all constants with no masking (address muxes),
+//          sort by value and convert to a binary tree of < compares, with == compares at
+//          the leaves.
 //      FUTURES:
-//          Large 16+ bit tables with constants and no masking (address muxes)
-//              Enter all into std::multimap, sort by value and use a tree of < and == compares.
 //          "Diagonal" find of {rightmost,leftmost} bit {set,clear}
 //              Ignoring mask, check each value is unique (using std::multimap as above?)
 //              Each branch is then mask-and-compare operation (IE
@@ -45,6 +46,8 @@ VL_DEFINE_DEBUG_FUNCTIONS;
 #define CASE_OVERLAP_WIDTH 16  // Maximum width we can check for overlaps in
 #define CASE_BARF 999999  // Magic width when non-constant
 #define CASE_ENCODER_GROUP_DEPTH 8  // Levels of priority to be ORed together in top IF tree
+#define CASE_SORTED_MIN_VALUES 16  // Minimum values to convert to a sorted compare tree
+#define CASE_SORTED_LEAF_VALUES 4  // Values compared for equality at each sorted tree leaf
 
 //######################################################################
 
@@ -138,6 +141,7 @@ class CaseVisitor final : public VNVisitor {
     // STATE
     VDouble0 m_statCaseFast;  // Statistic tracking
     VDouble0 m_statCaseSlow;  // Statistic tracking
+    VDouble0 m_statCaseSorted;  // Statistic tracking
     const AstNode* m_alwaysp = nullptr;  // Always in which case is located
 
     // Per-CASE
@@ -148,6 +152,13 @@ class CaseVisitor final : public VNVisitor {
     // For each possible value, the case branch we need
     std::array<AstNode*, 1 << CASE_OVERLAP_WIDTH> m_valueItem;
     bool m_needToClearCache = false;  // Whether cache needs to be cleared
+    // For sorted compare tree, each value in ascending order, with its constant and item
+    struct SortedValue final {
+        uint64_t m_value;  // Value of the condition
+        AstConst* m_constp;  // Condition
+        AstCaseItem* m_itemp;  // Case item selected by that value
+    };
+    std::vector<SortedValue> m_sortedValues;
 
     // METHODS
     //! Determine whether we should check case items are complete
@@ -438,6 +449,132 @@ class CaseVisitor final : public VNVisitor {
         UINFOTREE(9, ifrootp, "", "_simp");
     }
 
+    static size_t stmtsCount(const AstNode* stmtsp) {
+        size_t count = 0;
+        for (const AstNode* stmtp = stmtsp; stmtp; stmtp = stmtp->nextp()) {
+            count += stmtp->nodeCount();
+        }
+        return count;
+    }
+
+    bool isCaseTreeSorted(AstCase* nodep) {
+        // Check all conditions are constants without wildcards, so the selected
+        // item can be found by a binary search on the value
+        AstNodeExpr* const cexprp = nodep->exprp();
+        if (!cexprp->isPure() || cexprp->isDouble() || cexprp->isString()) return false;
+        if (cexprp->width() > 64) return false;
+        std::map<uint64_t, SortedValue> values;
+        const AstCaseItem* defaultp = nullptr;
+        for (AstCaseItem* itemp = nodep->itemsp(); itemp;
+             itemp = VN_AS(itemp->nextp(), CaseItem)) {
+            if (itemp->isDefault()) {
+                defaultp = itemp;
+                continue;
+            }
+            for (AstNode* icondp = itemp->condsp(); icondp; icondp = icondp->nextp()) {
+                AstConst* const iconstp = VN_CAST(icondp, Const);
+                if (!iconstp || iconstp->num().isFourState() || iconstp->num().isDouble()
+                    || iconstp->num().isString() || iconstp->width() != cexprp->width()) {
+                    return false;
+                }
+                // Earlier items have priority, so later duplicates are ignored
+                const uint64_t value = iconstp->num().toUQuad();
+                values.emplace(value, SortedValue{value, iconstp, itemp});
+            }
+        }
+        if (values.size() < CASE_SORTED_MIN_VALUES) return false;
+        m_sortedValues.clear();
+        for (const auto& pair : values) m_sortedValues.push_back(pair.second);
+        // Each leaf duplicates the default and any item with values in several
+        // leaves, don't let this more than double the code size
+        const size_t defaultCount = defaultp ? stmtsCount(defaultp->stmtsp()) : 0;
+        size_t origCount = defaultCount;
+        for (const AstCaseItem* itemp = nodep->itemsp(); itemp;
+             itemp = VN_AS(itemp->nextp(), CaseItem)) {
+            if (!itemp->isDefault()) origCount += stmtsCount(itemp->stmtsp());
+        }
+        size_t newCount = 0;
+        for (size_t lo = 0; lo < m_sortedValues.size(); lo += CASE_SORTED_LEAF_VALUES) {
+            const size_t hi = std::min(lo + CASE_SORTED_LEAF_VALUES, m_sortedValues.size());
+            newCount += defaultCount;
+            for (size_t i = lo; i < hi; ++i) {
+                const AstCaseItem* const itemp = m_sortedValues[i].m_itemp;
+                bool seen = false;
+                for (size_t j = lo; j < i; ++j) seen |= m_sortedValues[j].m_itemp == itemp;
+                if (!seen) newCount += stmtsCount(itemp->stmtsp());
+            }
+        }
+        return newCount <= 2 * origCount;
+    }
+
+    AstNode* replaceCaseSortedLeaf(AstNodeExpr* cexprp, size_t lo, size_t hi,
+                                   AstNode* defaultStmtsp) {
+        // IF chain comparing each value for equality, values of the same item ORed
+        std::vector<std::pair<AstCaseItem*, AstNodeExpr*>> itemConds;
+        for (size_t i = lo; i < hi; ++i) {
+            const SortedValue& sv = m_sortedValues[i];
+            AstNodeExpr* const condp
+                = AstEq::newTyped(sv.m_constp->fileline(), cexprp->cloneTreePure(false),
+                                  sv.m_constp->cloneTree(false));
+            const auto it = std::find_if(
+                itemConds.begin(), itemConds.end(),
+                [&sv](const std::pair<AstCaseItem*, AstNodeExpr*>& p) {
+                    return p.first == sv.m_itemp;
+                });
+            if (it == itemConds.end()) {
+                itemConds.emplace_back(sv.m_itemp, condp);
+            } else {
+                it->second = new AstLogOr{condp->fileline(), it->second, condp};
+            }
+        }
+        AstNode* resultp = defaultStmtsp ? defaultStmtsp->cloneTree(true) : nullptr;
+        for (auto it = itemConds.rbegin(); it != itemConds.rend(); ++it) {
+            AstNode* const stmtsp = it->first->stmtsp();
+            resultp = new AstIf{it->first->fileline(), it->second,
+                                stmtsp ? stmtsp->cloneTree(true) : nullptr, resultp};
+        }
+        return resultp;
+    }
+
+    AstNode* replaceCaseSortedRecurse(AstNodeExpr* cexprp, size_t lo, size_t hi,
+                                      AstNode* defaultStmtsp) {
+        // Binary search on the values in [lo, hi)
+        if (hi - lo <= CASE_SORTED_LEAF_VALUES) {
+            return replaceCaseSortedLeaf(cexprp, lo, hi, defaultStmtsp);
+        }
+        // Split on a leaf boundary so leaves are full
+        const size_t leaves = (hi - lo + CASE_SORTED_LEAF_VALUES - 1) / CASE_SORTED_LEAF_VALUES;
+        const size_t mid = lo + (leaves / 2) * CASE_SORTED_LEAF_VALUES;
+        AstConst* const pivotp = m_sortedValues[mid].m_constp;
+        AstNodeExpr* const condp = new AstLt{pivotp->fileline(), cexprp->cloneTreePure(false),
+                                             pivotp->cloneTree(false)};
+        return new AstIf{pivotp->fileline(), condp,
+                         replaceCaseSortedRecurse(cexprp, lo, mid, defaultStmtsp),
+                         replaceCaseSortedRecurse(cexprp, mid, hi, defaultStmtsp)};
+    }
+
+    void replaceCaseSorted(AstCase* nodep) {
+        // CASE(cexpr, ITEM(v0, s0), ITEM(v1, s1), ..., ITEM(default, sd))
+        // ->  IF(cexpr < vmid,
+        //        IF(cexpr < vlow, ..., ...),
+        //        ... IF(cexpr == vn, sn, IF(cexpr == vn+1, sn+1, ... sd)))
+        AstNodeExpr* const cexprp = nodep->exprp()->unlinkFrBack();
+        AstNode* defaultStmtsp = nullptr;
+        for (AstCaseItem* itemp = nodep->itemsp(); itemp;
+             itemp = VN_AS(itemp->nextp(), CaseItem)) {
+            if (itemp->isDefault()) defaultStmtsp = itemp->stmtsp();
+        }
+        AstNode* const ifrootp
+            = replaceCaseSortedRecurse(cexprp, 0, m_sortedValues.size(), defaultStmtsp);
+        // Handle any assertions
+        replaceCaseParallel(nodep, false);
+        nodep->replaceWith(ifrootp);
+        VL_DO_DANGLING(nodep->deleteTree(), nodep);
+        VL_DO_DANGLING(cexprp->deleteTree(), cexprp);
+        m_sortedValues.clear();
+        UINFOTREE(9, ifrootp, "", "_sorted");
+    }
+
     void replaceCaseComplicated(AstCase* nodep) {
         // CASEx(cexpr,ITEM(icond1,istmts1),ITEM(icond2,istmts2),ITEM(default,istmts3))
         // ->  IF((cexpr==icond1),istmts1,
@@ -628,8 +765,14 @@ class CaseVisitor final : public VNVisitor {
             // If a case statement is whole, presume signals involved aren't forming a latch
             if (m_alwaysp && !m_caseIncomplete)
                 m_alwaysp->fileline()->warnOff(V3ErrorCode::LATCH, true);
-            ++m_statCaseSlow;
-            VL_DO_DANGLING(replaceCaseComplicated(nodep), nodep);
+            if (v3Global.opt.fCase() && isCaseTreeSorted(nodep)) {
+                // Many constants, e.g. an address decoder, binary search for the item
+                ++m_statCaseSorted;
+                VL_DO_DANGLING(replaceCaseSorted(nodep), nodep);
+            } else {
+                ++m_statCaseSlow;
+                VL_DO_DANGLING(replaceCaseComplicated(nodep), nodep);
+            }
         }
     }
     //--------------------
@@ -650,6 +793,7 @@ public:
     ~CaseVisitor() override {
         V3Stats::addStat("Optimizations, Cases parallelized", m_statCaseFast);
         V3Stats::addStat("Optimizations, Cases complex", m_statCaseSlow);
+        V3Stats::addStat("Optimizations, Cases sorted", m_statCaseSorted);
     }
 };
 
@@ -783,12 +783,21 @@ public:
 };
 
 class V3ControlResolver final {
-    enum ProfileDataMode : uint8_t { NONE = 0, MTASK = 1, HIER_DPI = 2 };
+    enum ProfileDataMode : uint8_t {
+        NONE = 0,
+        MTASK = 1,
+        HIER_DPI = 2,
+        BRANCH = 4,
+        FUNCTION = 8
+    };
+    using CountMap = std::unordered_map<string, std::unordered_map<string, uint64_t>>;
     V3ControlModuleResolver m_modules;  // Access to module names (with wildcards)
     V3ControlFileResolver m_files;  // Access to file names (with wildcards)
     V3ControlScopeTraceResolver m_scopeTraces;  // Regexp to trace enables
     std::unordered_map<string, std::unordered_map<string, uint64_t>>
         m_profileData;  // Access to profile_data records
+    CountMap m_branchData;  // Access to profile_data -branch records
+    CountMap m_functionData;  // Access to profile_data -function records
     uint8_t m_mode = NONE;
     std::unordered_map<string, V3ControlResolverHierWorkerEntry> m_hierWorkers;
     FileLine* m_profileFileLine = nullptr;
@@ -820,6 +829,39 @@ public:
         }
         m_mode |= mode;
     }
+    void addCountProfileData(FileLine* fl, const string& model, const string& key,
+                             uint64_t count, ProfileDataMode mode) {
+        // Execution counts, unlike costs, may be zero
+        if (!m_profileFileLine) m_profileFileLine = fl;
+        CountMap& data = mode == BRANCH ? m_branchData : m_functionData;
+        data[model][key] += count;
+        m_mode |= mode;
+    }
+    void addBranchProfileData(FileLine* fl, const string& model, const string& key,
+                              uint64_t count) {
+        addCountProfileData(fl, model, key, count, BRANCH);
+    }
+    void addFunctionProfileData(FileLine* fl, const string& model, const string& key,
+                                uint64_t count) {
+        addCountProfileData(fl, model, key, count, FUNCTION);
+    }
+    static bool getCountProfileData(const CountMap& data, const string& model, const string& key,
+                                    uint64_t& countr) {
+        const auto mit = data.find(model);
+        if (mit == data.cend()) return false;
+        const auto it = mit->second.find(key);
+        if (it == mit->second.cend()) return false;
+        countr = it->second;
+        return true;
+    }
+    bool containsBranchProfileData() const { return m_mode & BRANCH; }
+    bool getBranchProfileData(const string& model, const string& key, uint64_t& countr) const {
+        return getCountProfileData(m_branchData, model, key, countr);
+    }
+    bool containsFunctionProfileData() const { return m_mode & FUNCTION; }
+    bool getFunctionProfileData(const string& model, const string& key, uint64_t& countr) const {
+        return getCountProfileData(m_functionData, model, key, countr);
+    }
     bool containsMTaskProfileData() const { return m_mode & MTASK; }
     uint64_t getProfileData(const string& hierDpi) const {
         // Empty key for hierarchical DPI wrapper costs.
@@ -861,6 +903,16 @@ public:
 //######################################################################
 // V3Control
 
+void V3Control::addBranchProfileData(FileLine* fl, const string& model, const string& key,
+                                     uint64_t count) {
+    V3ControlResolver::s().addBranchProfileData(fl, model, key, count);
+}
+
+void V3Control::addFunctionProfileData(FileLine* fl, const string& model, const string& key,
+                                       uint64_t count) {
+    V3ControlResolver::s().addFunctionProfileData(fl, model, key, count);
+}
+
 void V3Control::addCaseFull(const string& filename, int lineno) {
     V3ControlFile& file = V3ControlResolver::s().files().at(filename);
     file.addLineAttribute(lineno, VPragmaType::FULL_CASE);
@@ -1064,6 +1116,12 @@ void V3Control::applyVarAttr(const AstNodeModule* modulep, const AstNodeFTask* f
     }
 }
 
+bool V3Control::getBranchProfileData(const string& model, const string& key, uint64_t& countr) {
+    return V3ControlResolver::s().getBranchProfileData(model, key, countr);
+}
+bool V3Control::getFunctionProfileData(const string& model, const string& key, uint64_t& countr) {
+    return V3ControlResolver::s().getFunctionProfileData(model, key, countr);
+}
 int V3Control::getHierWorkers(const string& model) {
     return V3ControlResolver::s().getHierWorkers(model);
 }
@@ -1085,6 +1143,12 @@ bool V3Control::getScopeTraceOn(const string& scope) {
 
 void V3Control::contentsPushText(const string& text) { return WildcardContents::pushText(text); }
 
+bool V3Control::containsBranchProfileData() {
+    return V3ControlResolver::s().containsBranchProfileData();
+}
+bool V3Control::containsFunctionProfileData() {
+    return V3ControlResolver::s().containsFunctionProfileData();
+}
 bool V3Control::containsMTaskProfileData() {
     return V3ControlResolver::s().containsMTaskProfileData();
 }
@@ -37,8 +37,12 @@ public:
 
     static void addCaseFull(const string& file, int lineno);
     static void addCaseParallel(const string& file, int lineno);
+    static void addBranchProfileData(FileLine* fl, const string& model, const string& key,
+                                     uint64_t count);
     static void addCoverageBlockOff(const string& file, int lineno);
     static void addCoverageBlockOff(const string& module, const string& blockname);
+    static void addFunctionProfileData(FileLine* fl, const string& model, const string& key,
+                                       uint64_t count);
     static void addHierWorkers(FileLine* fl, const string& model, int workers);
     static void addIgnore(V3ErrorCode code, bool on, const string& filename, int min, int max);
     static void addIgnoreMatch(V3ErrorCode code, const string& filename, const string& contents,
@@ -62,6 +66,9 @@ public:
     static void applyVarAttr(const AstNodeModule* modulep, const AstNodeFTask* ftaskp,
                              AstVar* varp);
 
+    static bool getBranchProfileData(const string& model, const string& key, uint64_t& countr);
+    static bool getFunctionProfileData(const string& model, const string& key,
+                                       uint64_t& countr);
     static int getHierWorkers(const string& model);
     static FileLine* getHierWorkersFileLine(const string& model);
     static uint64_t getProfileData(const string& hierDpi);
@@ -71,6 +78,8 @@ public:
 
     static void contentsPushText(const string& text);
 
+    static bool containsBranchProfileData();
+    static bool containsFunctionProfileData();
     static bool containsMTaskProfileData();
     static uint64_t getCurrentHierBlockCost();
 
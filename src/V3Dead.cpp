@@ -37,6 +37,7 @@
 
 #include "V3Dead.h"
 
+#include "V3AstArena.h"
 #include "V3Stats.h"
 
 #include <queue>
@@ -603,6 +604,7 @@ void V3Dead::deadifyModules(AstNetlist* nodep) {
     {  // node, elimUserVars, elimDTypes, elimScopes, elimCells, elimTopIfaces
         DeadVisitor{nodep, false, false, false, false, !v3Global.opt.topIfacesSupported(), false};
     }  // Destruct before checking
+    V3AstArena::compactIfFragmented();
     V3Global::dumpCheckGlobalTree("deadModules", 0, dumpTreeEitherLevel() >= 6);
 }
 
@@ -621,11 +623,13 @@ void V3Dead::deadifyDTypesScoped(AstNetlist* nodep) {
 void V3Dead::deadifyAll(AstNetlist* nodep) {
     UINFO(2, __FUNCTION__ << ":");
     { DeadVisitor{nodep, true, true, false, true, false, true}; }  // Destruct before checking
+    V3AstArena::compactIfFragmented();
     V3Global::dumpCheckGlobalTree("deadAll", 0, dumpTreeEitherLevel() >= 3);
 }
 
 void V3Dead::deadifyAllScoped(AstNetlist* nodep) {
     UINFO(2, __FUNCTION__ << ":");
     { DeadVisitor{nodep, true, true, true, true, false, true}; }  // Destruct before checking
+    V3AstArena::compactIfFragmented();
     V3Global::dumpCheckGlobalTree("deadAllScoped", 0, dumpTreeEitherLevel() >= 3);
 }
@@ -262,7 +262,9 @@ class DataflowOptimize final {
                     const AstVar* const varp = vscp->varp();
                     // Force and trace have already been processed
                     const bool hasExtRd = varp->isPrimaryIO() || varp->isSigUserRdPublic();
-                    const bool hasExtWr = varp->isPrimaryIO() || varp->isSigUserRWPublic();
+                    // Shared parameters are per-instance, so do not propagate their values
+                    const bool hasExtWr = varp->isPrimaryIO() || varp->isSigUserRWPublic()  //
+                                          || varp->sharedParam();
                     if (hasExtRd) DfgVertexVar::setHasExtRdRefs(vscp);
                     if (hasExtWr) DfgVertexVar::setHasExtWrRefs(vscp);
                     return;
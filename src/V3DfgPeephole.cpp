@@ -514,6 +514,77 @@ class V3DfgPeephole final : public DfgVisitor {
         return false;
     }
 
+    // Bit slicing: a Concat of the same operations on adjoining bits of the same
+    // values, as a gate level netlist has for each bit of a bus, can be computed
+    // as one operation over the joined bits. Operations considered for joining:
+    static bool isBitSliceOp(const DfgVertex* vtxp) {
+        return vtxp->is<DfgAnd>() || vtxp->is<DfgOr>() || vtxp->is<DfgXor>()
+               || vtxp->is<DfgNot>() || vtxp->is<DfgCond>();
+    }
+
+    // Can the bits computed by 'hip' and 'lop' be computed as one joined vertex,
+    // 'hip' being the more significant? 'depth' limits the operations to look through.
+    static bool isBitSliceJoinable(const DfgVertex* hip, const DfgVertex* lop, unsigned depth) {
+        // Adjoining selects of the same value, or constants, join trivially
+        if (const DfgSel* const hSelp = hip->cast<DfgSel>()) {
+            const DfgSel* const lSelp = lop->cast<DfgSel>();
+            return lSelp && isSame(hSelp->fromp(), lSelp->fromp())
+                   && hSelp->lsb() == lSelp->lsb() + lSelp->width();
+        }
+        if (hip->is<DfgConst>()) return lop->is<DfgConst>();
+        // Otherwise must be the same operation, with no other sinks, on joinable operands
+        if (!depth || !isBitSliceOp(hip) || hip->type() != lop->type()) return false;
+        if (hip->hasMultipleSinks() || lop->hasMultipleSinks()) return false;
+        if (const DfgCond* const hCondp = hip->cast<DfgCond>()) {
+            if (hCondp->condp() != lop->as<DfgCond>()->condp()) return false;
+        }
+        const size_t first = hip->is<DfgCond>() ? 1 : 0;  // Condition is shared, not joined
+        bool joinable = true;
+        for (size_t i = first; joinable && i < hip->nInputs(); ++i) {
+            joinable = isBitSliceJoinable(hip->inputp(i), lop->inputp(i), depth - 1);
+        }
+        if (joinable || hip->is<DfgNot>() || hip->is<DfgCond>()) return joinable;
+        // Commutative operands may be ordered differently in each bit
+        return isBitSliceJoinable(hip->inputp(0), lop->inputp(1), depth - 1)
+               && isBitSliceJoinable(hip->inputp(1), lop->inputp(0), depth - 1);
+    }
+
+    // Create the joined vertex, which must be isBitSliceJoinable
+    DfgVertex* joinBitSlices(FileLine* flp, DfgVertex* hip, DfgVertex* lop, unsigned depth) {
+        const DfgDataType& dtype = DfgDataType::packed(hip->width() + lop->width());
+        if (DfgSel* const lSelp = lop->cast<DfgSel>()) {
+            return make<DfgSel>(flp, dtype, lSelp->fromp(), lSelp->lsb());
+        }
+        if (DfgConst* const lConstp = lop->cast<DfgConst>()) {
+            DfgConst* const constp = makeZero(flp, dtype.size());
+            constp->num().opConcat(hip->as<DfgConst>()->num(), lConstp->num());
+            return constp;
+        }
+        if (hip->is<DfgNot>()) {
+            return make<DfgNot>(flp, dtype,
+                                joinBitSlices(flp, hip->inputp(0), lop->inputp(0), depth - 1));
+        }
+        if (DfgCond* const hCondp = hip->cast<DfgCond>()) {
+            DfgCond* const lCondp = lop->as<DfgCond>();
+            DfgVertex* const thenp
+                = joinBitSlices(flp, hCondp->thenp(), lCondp->thenp(), depth - 1);
+            DfgVertex* const elsep
+                = joinBitSlices(flp, hCondp->elsep(), lCondp->elsep(), depth - 1);
+            return make<DfgCond>(flp, dtype, hCondp->condp(), thenp, elsep);
+        }
+        DfgVertex* lLhsp = lop->inputp(0);
+        DfgVertex* lRhsp = lop->inputp(1);
+        if (!isBitSliceJoinable(hip->inputp(0), lLhsp, depth - 1)
+            || !isBitSliceJoinable(hip->inputp(1), lRhsp, depth - 1)) {
+            std::swap(lLhsp, lRhsp);
+        }
+        DfgVertex* const lhsp = joinBitSlices(flp, hip->inputp(0), lLhsp, depth - 1);
+        DfgVertex* const rhsp = joinBitSlices(flp, hip->inputp(1), lRhsp, depth - 1);
+        if (hip->is<DfgAnd>()) return make<DfgAnd>(flp, dtype, lhsp, rhsp);
+        if (hip->is<DfgOr>()) return make<DfgOr>(flp, dtype, lhsp, rhsp);
+        return make<DfgXor>(flp, dtype, lhsp, rhsp);
+    }
+
     template <typename Vertex>
     VL_ATTR_WARN_UNUSED_RESULT bool tryPushCompareOpThroughConcat(Vertex* vtxp, DfgConst* constp,
                                                                   DfgConcat* concatp) {
@@ -1306,6 +1377,29 @@ class V3DfgPeephole final : public DfgVisitor {
             }
         }
 
+        // Bit slicing, see isBitSliceJoinable
+        if (isBitSliceOp(lhsp)) {
+            // Maximum depth of operations to join, bounds the search
+            constexpr unsigned maxDepth = 4;
+            if (isBitSliceJoinable(lhsp, rhsp, maxDepth)) {
+                APPLYING(REPLACE_CONCAT_OF_BIT_SLICES) {
+                    replace(vtxp, joinBitSlices(flp, lhsp, rhsp, maxDepth));
+                    return;
+                }
+            }
+            if (DfgConcat* const rConcatp = rhsp->cast<DfgConcat>()) {
+                if (!rConcatp->hasMultipleSinks()
+                    && isBitSliceJoinable(lhsp, rConcatp->lhsp(), maxDepth)) {
+                    APPLYING(REPLACE_NESTED_CONCAT_OF_BIT_SLICES_ON_LHS) {
+                        DfgVertex* const joinedp
+                            = joinBitSlices(flp, lhsp, rConcatp->lhsp(), maxDepth);
+                        replace(vtxp, make<DfgConcat>(vtxp, joinedp, rConcatp->rhsp()));
+                        return;
+                    }
+                }
+            }
+        }
+
         // Attempt to narrow a concatenation that produces unused bits on the edges
         {
             const uint32_t vMsb = vtxp->width() - 1;  // MSB of the concatenation
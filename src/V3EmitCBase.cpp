@@ -243,6 +243,7 @@ void EmitCBaseVisitorConst::emitVarDecl(const AstVar* nodep, bool asRef) {
                                   && name.substr(name.size() - suffix.size()) == suffix;
             if (beStatic) puts("static thread_local ");
         }
+        if (nodep->cacheLinePad() && !asRef) puts("alignas(VL_CACHE_LINE_BYTES) ");
         putns(nodep, nodep->vlArgType(true, false, false, "", asRef));
         puts(";\n");
     }
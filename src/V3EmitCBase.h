@@ -71,6 +71,7 @@ public:
         AstNodeDType* const dtp = varp->dtypep()->skipRefp();
         return v3Global.opt.compLimitMembers() != 0  // Enabled
                && !varp->isStatic()  // Not a static variable
+               && !varp->cacheLinePad()  // Needs its own alignment
                && !varp->isSc()  // Aggregates can't be anon
                && !VN_IS(dtp, SampleQueueDType)  // Aggregates can't be anon
                && !(VN_IS(dtp, NodeUOrStructDType) && !VN_CAST(dtp, NodeUOrStructDType)->packed())
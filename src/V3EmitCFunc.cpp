@@ -41,6 +41,33 @@ bool EmitCFunc::emitSimpleOk(AstNodeExpr* nodep) {
     return true;
 }
 
+string EmitCFunc::wideFixedFormat(AstNodeExpr* nodep) {
+    // Format using the VL_*_W<words> functions with a compile time word count,
+    // instead of the emitC() VL_*_W(words, ...) form, or "" if none applies
+    if (!v3Global.opt.fWideSimd()) return "";
+    const AstNodeExpr* const lhsp = VN_CAST(nodep->op1p(), NodeExpr);
+    const AstNodeExpr* const rhsp = VN_CAST(nodep->op2p(), NodeExpr);
+    if (!lhsp || !lhsp->isWide()) return "";
+    const string words = cvtToStr(lhsp->widthWords());
+    if (VN_IS(nodep, Eq) || VN_IS(nodep, EqCase) || VN_IS(nodep, Neq)
+        || VN_IS(nodep, NeqCase)) {
+        if (rhsp->widthWords() != lhsp->widthWords()) return "";
+        const string eq = "VL_EQ_W<" + words + ">(%li, %ri)";
+        return (VN_IS(nodep, Eq) || VN_IS(nodep, EqCase)) ? eq : "(!" + eq + ")";
+    }
+    // Others produce a result of the same size as the lhs
+    if (nodep->widthWords() != lhsp->widthWords()) return "";
+    if (VN_IS(nodep, Not)) return "VL_NOT_W<" + words + ">(%P, %li)";
+    if (rhsp && VN_IS(nodep, And)) return "VL_AND_W<" + words + ">(%P, %li, %ri)";
+    if (rhsp && VN_IS(nodep, Or)) return "VL_OR_W<" + words + ">(%P, %li, %ri)";
+    if (rhsp && VN_IS(nodep, Xor)) return "VL_XOR_W<" + words + ">(%P, %li, %ri)";
+    // Shifts by a 32-bit amount only, as VL_SHIFT*_WWI
+    if (!rhsp || rhsp->isWide() || rhsp->isQuad()) return "";
+    if (VN_IS(nodep, ShiftL)) return "VL_SHIFTL_W<" + words + ">(%nw, %P, %li, %ri)";
+    if (VN_IS(nodep, ShiftR)) return "VL_SHIFTR_W<" + words + ">(%nw, %P, %li, %ri)";
+    return "";
+}
+
 void EmitCFunc::emitOpName(AstNode* nodep, const string& format, AstNode* lhsp, AstNode* rhsp,
                            AstNode* thsp) {
     // Look at emitOperator() format for term/uni/dual/triops,
@@ -177,6 +177,7 @@ public:
                     char fmtLetter);
 
     bool emitSimpleOk(AstNodeExpr* nodep);
+    string wideFixedFormat(AstNodeExpr* nodep);
     void emitIQW(const AstNode* nodep) {
         // See "Type letters" in verilated.h
         // Other abbrevs: "C"har, "S"hort, "F"loat, "D"ouble, stri"N"g, "R"=queue, "U"npacked
@@ -1435,7 +1436,9 @@ public:
             iterateAndNextConstNull(nodep->lhsp());
             puts(")");
         } else {
-            emitOpName(nodep, nodep->emitC(), nodep->lhsp(), nullptr, nullptr);
+            const string fixedFormat = wideFixedFormat(nodep);
+            emitOpName(nodep, fixedFormat.empty() ? nodep->emitC() : fixedFormat, nodep->lhsp(),
+                       nullptr, nullptr);
         }
     }
     void visit(AstNodeBiop* nodep) override {
@@ -1455,7 +1458,9 @@ public:
             iterateAndNextConstNull(nodep->rhsp());
             puts(")");
         } else {
-            emitOpName(nodep, nodep->emitC(), nodep->lhsp(), nodep->rhsp(), nullptr);
+            const string fixedFormat = wideFixedFormat(nodep);
+            emitOpName(nodep, fixedFormat.empty() ? nodep->emitC() : fixedFormat, nodep->lhsp(),
+                       nodep->rhsp(), nullptr);
         }
     }
     void visit(AstNodeTriop* nodep) override {
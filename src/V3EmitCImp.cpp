@@ -18,11 +18,16 @@
 
 #include "V3EmitC.h"
 #include "V3EmitCFunc.h"
+#include "V3Hash.h"
+#include "V3Stats.h"
 #include "V3ThreadPool.h"
 #include "V3UniqueNames.h"
 
+#include <algorithm>
+#include <cctype>
 #include <map>
 #include <set>
+#include <unordered_map>
 #include <vector>
 
 VL_DEFINE_DEBUG_FUNCTIONS;
@@ -37,6 +42,10 @@ class EmitCImp final : public EmitCFunc {
     const bool m_slow;  // Creating __Slow file
     V3UniqueNames m_uniqueNames;  // Generates unique file names
     const std::string m_fileBaseName = EmitCUtil::prefixNameProtect(m_fileModp);
+    // Assigning functions to files by content, see emitCFuncImpStable
+    const bool m_stableSplit = v3Global.opt.outputSplitStable() && v3Global.opt.outputSplit();
+    // On average one in this many functions ends a file with --output-split-stable
+    static constexpr uint32_t STABLE_SPLIT_BOUNDARY = 4;
 
     // METHODS
     void openNextOutputFile(const std::string& fileName) {
@@ -419,6 +428,11 @@ class EmitCImp final : public EmitCFunc {
         // Do not create empty files
         if (funcps.empty()) return;
 
+        if (m_stableSplit) {
+            emitCFuncImpStable(funcps);
+            return;
+        }
+
         // Open output file
         openNextOutputFile(m_uniqueNames.get(m_fileBaseName));
         // Emit all functions
@@ -431,9 +445,44 @@ class EmitCImp final : public EmitCFunc {
         closeOutputFile();
     }
 
+    void emitCFuncImpStable(std::vector<AstCFunc*>& funcps) {
+        // Assign functions to files by content, so that a local change to the design
+        // only changes the few files holding the affected functions. Functions are
+        // ordered by their (content derived) name, and a file boundary is placed after
+        // a function whose name hash has a particular value, as long as the file is not
+        // too small. Adding or removing a function so only moves its neighbours.
+        const size_t limit = static_cast<size_t>(v3Global.opt.outputSplit());
+        std::stable_sort(funcps.begin(), funcps.end(), [](const AstCFunc* ap, const AstCFunc* bp) {
+            return ap->name() < bp->name();
+        });
+        std::vector<AstCFunc*> groupps;
+        size_t groupSize = 0;
+        for (size_t i = 0; i < funcps.size(); ++i) {
+            AstCFunc* const funcp = funcps[i];
+            groupps.push_back(funcp);
+            groupSize += static_cast<size_t>(funcp->nodeCount());
+            const bool boundary = groupSize >= limit / 2
+                                  && V3Hash{funcp->name()}.value() % STABLE_SPLIT_BOUNDARY == 0;
+            if (boundary || groupSize >= 2 * limit || i + 1 == funcps.size()) {
+                // Name file after its first function, so it does not depend on other files
+                openNextOutputFile(m_uniqueNames.get(
+                    m_fileBaseName + "__" + V3Hash{groupps.front()->name()}.toString()));
+                for (AstCFunc* const groupFuncp : groupps) {
+                    VL_RESTORER(m_modp);
+                    m_modp = EmitCParentModule::get(groupFuncp);
+                    iterateConst(groupFuncp);
+                }
+                closeOutputFile();
+                if (i + 1 != funcps.size()) v3Global.useParallelBuild(true);
+                groupps.clear();
+                groupSize = 0;
+            }
+        }
+    }
+
     // VISITORS
     void visit(AstCFunc* nodep) override {
-        if (splitNeeded()) {
+        if (!m_stableSplit && splitNeeded()) {
             // Splitting file, so using parallel build.
             v3Global.useParallelBuild(true);
             // Close old file
@@ -876,6 +925,112 @@ public:
     }
 };
 
+//######################################################################
+// Stable function naming for --output-split-stable
+
+class EmitCStableNames final : public VNVisitorConst {
+    // STATE
+    V3Hash m_hash;  // Hash of function body being computed
+    string* m_textp = nullptr;  // If not null, text of function body being computed
+    std::unordered_map<const AstCFunc*, string> m_texts;  // Body text, to order equal hashes
+
+    // METHODS
+    static string stripNumber(const string& name) {
+        // Remove the trailing '__<number>' added when the function was created, if any
+        const size_t pos = name.rfind("__");
+        if (pos == string::npos || pos + 2 == name.size()) return name;
+        for (size_t i = pos + 2; i < name.size(); ++i) {
+            if (!std::isdigit(name[i])) return name;
+        }
+        return name.substr(0, pos);
+    }
+    static bool renameable(const AstCFunc* funcp) {
+        // Only internal functions, which are declared lazily where they are used
+        return funcp->isLoose() && !funcp->entryPoint() && !funcp->isTrace()
+               && !funcp->isConstructor() && !funcp->isDestructor() && !funcp->funcPublic()
+               && !funcp->dpiImportPrototype() && !funcp->dpiImportWrapper()
+               && !funcp->dpiExportDispatcher() && !funcp->dpiExportImpl()
+               && stripNumber(funcp->name()) != funcp->name();
+    }
+
+    // Full text of the function body that is hashed, computed only when hashes are equal
+    const string& bodyText(AstCFunc* funcp) {
+        const auto it = m_texts.find(funcp);
+        if (it != m_texts.end()) return it->second;
+        string& text = m_texts[funcp];
+        VL_RESTORER(m_textp);
+        m_textp = &text;
+        iterateChildrenConst(funcp);
+        return text;
+    }
+
+    // VISITORS
+    void visit(AstNodeCCall* nodep) override {
+        // Callee is hashed by its base name, so its renaming does not ripple to callers
+        const string callee = stripNumber(nodep->funcp()->name());
+        m_hash += nodep->type();
+        m_hash += callee;
+        if (m_textp) *m_textp += string{nodep->typeName()} + " " + callee + "\n";
+        iterateChildrenConst(nodep);
+    }
+    void visit(AstNode* nodep) override {
+        m_hash += nodep->type();
+        m_hash += nodep->name();
+        m_hash += nodep->width();
+        if (m_textp) {
+            *m_textp += string{nodep->typeName()} + " " + nodep->name() + " "
+                        + std::to_string(nodep->width()) + "\n";
+        }
+        iterateChildrenConst(nodep);
+    }
+
+    // CONSTRUCTORS
+    explicit EmitCStableNames(AstNodeModule* modp) {
+        std::set<string> names;  // Names in use in this module
+        std::vector<std::pair<AstCFunc*, string>> renames;
+        for (AstNode* nodep = modp->stmtsp(); nodep; nodep = nodep->nextp()) {
+            AstCFunc* const funcp = VN_CAST(nodep, CFunc);
+            if (!funcp) continue;
+            if (!renameable(funcp)) {
+                names.emplace(funcp->name());
+                continue;
+            }
+            m_hash = V3Hash{};
+            iterateChildrenConst(funcp);
+            renames.emplace_back(funcp, stripNumber(funcp->name()) + "__" + m_hash.toString());
+        }
+        // Disambiguate equal hashes in sorted order, by the body text when the
+        // hashes are equal, so the names do not depend on the order functions were
+        // created in. Only functions with identical bodies, which are then
+        // interchangeable, take their '_<n>' suffix in creation order.
+        using Rename = std::pair<AstCFunc*, string>;
+        std::stable_sort(renames.begin(), renames.end(), [this](const Rename& a, const Rename& b) {
+            if (a.second != b.second) return a.second < b.second;
+            return bodyText(a.first) < bodyText(b.first);
+        });
+        for (const auto& pair : renames) {
+            string name = pair.second;
+            for (int n = 1; !names.emplace(name).second; ++n) {
+                name = pair.second + "_" + std::to_string(n);
+            }
+            UINFO(9, "Stable rename " << pair.first->name() << " -> " << name);
+            pair.first->name(name);
+        }
+        V3Stats::addStatSum("EmitC, Stable function names", renames.size());
+    }
+    ~EmitCStableNames() override = default;
+
+public:
+    static void apply() {
+        for (AstNode* nodep = v3Global.rootp()->modulesp(); nodep; nodep = nodep->nextp()) {
+            if (AstNodeModule* const modp = VN_CAST(nodep, NodeModule)) {
+                if (VN_IS(modp, Class)) continue;  // Methods are declared in the class header
+                EmitCStableNames{modp};
+            }
+        }
+    }
+};
+
 //######################################################################
 // EmitC class functions
 
@@ -915,6 +1070,11 @@ void V3EmitC::emitcImp() {
     }
 }
 
+void V3EmitC::emitcStableNames() {
+    UINFO(2, __FUNCTION__ << ":");
+    EmitCStableNames::apply();
+}
+
 void V3EmitC::emitcFiles() {
     UINFO(2, __FUNCTION__ << ":");
     for (AstNodeFile *filep = v3Global.rootp()->filesp(), *nextp; filep; filep = nextp) {
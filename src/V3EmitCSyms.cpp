@@ -16,6 +16,7 @@
 
 #include "V3PchAstNoMT.h"  // VL_MT_DISABLED_CODE_UNIT
 
+#include "V3Branch.h"
 #include "V3EmitC.h"
 #include "V3EmitCBase.h"
 #include "V3ExecGraph.h"
@@ -495,7 +496,8 @@ void EmitCSyms::emitSymHdr() {
 
     if (v3Global.opt.profPgo()) {
         puts("\n// PGO PROFILING\n");
-        puts("VlPgoProfiler<" + std::to_string(ExecMTask::numUsedIds()) + "> _vm_pgoProfiler;\n");
+        puts("VlPgoProfiler<" + std::to_string(ExecMTask::numUsedIds()) + ", "
+             + std::to_string(V3Branch::pgoCounters().size()) + "> _vm_pgoProfiler;\n");
     }
 
     puts("\n// MODULE INSTANCE STATE\n");
@@ -533,6 +535,15 @@ void EmitCSyms::emitSymHdr() {
     puts(symClassName() + "(VerilatedContext* contextp, const char* namep, " + topClassName()
          + "* modelp);\n");
     puts("~" + symClassName() + "();\n");
+    if (v3Global.opt.mtasks()
+        && (v3Global.opt.threadsFirstTouch() || v3Global.opt.threadsHugePages())) {
+        // Leave pages untouched on allocation, so they are placed by first touch
+        const string hugePages = v3Global.opt.threadsHugePages() ? "true" : "false";
+        puts("static void* operator new(size_t size) {\n");
+        puts("return VlThreadPool::allocModel(size, " + hugePages + ");\n");
+        puts("}\n");
+        puts("static void operator delete(void* ptr) { VlThreadPool::freeModel(ptr); }\n");
+    }
 
     for (const std::string& funcName : m_splitFuncNames) { puts("void " + funcName + "();\n"); }
 
@@ -674,6 +685,13 @@ std::vector<std::string> EmitCSyms::getSymCtorStmts() {
                 }
             });
         }
+        const std::vector<V3Branch::PgoCounter>& counters = V3Branch::pgoCounters();
+        for (size_t i = 0; i < counters.size(); ++i) {
+            add(std::string{"_vm_pgoProfiler."}
+                + (counters[i].m_function ? "addFunctionCounter(" : "addBranchCounter(")
+                + std::to_string(i) + ", \""
+                + V3OutFormatter::quoteNameControls(counters[i].m_name) + "\");");
+        }
     }
 
     add("// Configure time unit / time precision");
@@ -27,7 +27,9 @@
 #include "V3Os.h"
 #include "V3Stats.h"
 
+#include <iomanip>
 #include <memory>
+#include <sstream>
 #include <unordered_map>
 #include <vector>
 
@@ -511,6 +513,7 @@ class PackThreads final {
             UASSERT(bestMtaskp, "Should have found some task");
 
             bestMtaskp->predictStart(bestTime);
+            bestMtaskp->threadId(bestThreadId);
             const uint32_t bestEndTime = schedule.scheduleOn(bestMtaskp, bestThreadId);
             busyUntil[bestThreadId] = bestEndTime;
 
@@ -925,7 +928,8 @@ void addMTaskToFunction(const ThreadSchedule& schedule, const uint32_t threadId,
         if (v3Global.opt.profExec()) {
             addCStmt("VL_EXEC_TRACE_ADD_RECORD(vlSymsp).threadScheduleWaitBegin();");
         }
-        addCStmt("vlSelf->" + name + +".waitUntilUpstreamDone(even_cycle);");
+        addCStmt("vlSymsp->__Vm_threadPoolp->waitUntilUpstreamDone(vlSelf->" + name
+                 + ", even_cycle);");
         if (v3Global.opt.profExec()) {
             addCStmt("VL_EXEC_TRACE_ADD_RECORD(vlSymsp).threadScheduleWaitEnd();");
         }
@@ -1023,7 +1027,9 @@ void addThreadStartWrapper(AstExecGraph* const execGraphp) {
 
     addCStmt("vlSymsp->__Vm_even_cycle__" + tag + " = !vlSymsp->__Vm_even_cycle__" + tag + ";");
 
-    if (!v3Global.opt.hierBlocks().empty()) addCStmt("std::vector<size_t> indexes;");
+    if (!v3Global.opt.hierBlocks().empty() && !v3Global.opt.threadsSharedQueue()) {
+        addCStmt("std::vector<size_t> indexes;");
+    }
 }
 
 void addThreadEndWrapper(AstExecGraph* const execGraphp) {
@@ -1082,8 +1088,8 @@ void addThreadStartToExecGraph(AstExecGraph* const execGraphp,
     if (v3Global.opt.profExec()) {
         addCStmt("VL_EXEC_TRACE_ADD_RECORD(vlSymsp).threadScheduleWaitBegin();");
     }
-    addCStmt("vlSelf->__Vm_mtaskstate_final__" + std::to_string(scheduleId) + tag
-             + ".waitUntilUpstreamDone(vlSymsp->__Vm_even_cycle__" + tag + ");");
+    addCStmt("vlSymsp->__Vm_threadPoolp->waitUntilUpstreamDone(vlSelf->__Vm_mtaskstate_final__"
+             + std::to_string(scheduleId) + tag + ", vlSymsp->__Vm_even_cycle__" + tag + ");");
     if (v3Global.opt.profExec()) {
         addCStmt("VL_EXEC_TRACE_ADD_RECORD(vlSymsp).threadScheduleWaitEnd();");
     }
@@ -1128,6 +1134,118 @@ void processMTaskBodies(AstExecGraph* const execGraphp) {
     }
 }
 
+//######################################################################
+// Parallelism report (--report-parallelism)
+
+// Attribute the estimated cost of an MTask to source lines and scopes
+class MTaskSourceCost final {
+    // STATE
+    std::map<std::string, uint64_t> m_lines;  // Cost per 'file:line'
+    std::map<std::string, uint64_t> m_scopes;  // Cost per scope
+    std::unordered_set<const AstCFunc*> m_visited;  // Functions already attributed
+    uint64_t m_total = 0;  // Sum of all attributed costs
+
+    void addFunc(AstCFunc* funcp, const std::string& scopeName) {
+        if (!m_visited.insert(funcp).second) return;
+        const std::string name = funcp->scopep() ? funcp->scopep()->prettyName() : scopeName;
+        for (AstNode* stmtp = funcp->stmtsp(); stmtp; stmtp = stmtp->nextp()) {
+            // Follow calls to the ordered logic functions
+            if (const AstStmtExpr* const sexprp = VN_CAST(stmtp, StmtExpr)) {
+                if (const AstCCall* const callp = VN_CAST(sexprp->exprp(), CCall)) {
+                    addFunc(callp->funcp(), name);
+                    continue;
+                }
+            }
+            const uint64_t cost = V3InstrCount::count(stmtp, false);
+            const FileLine* const flp = stmtp->fileline();
+            m_lines[flp->filename() + ":" + std::to_string(flp->lineno())] += cost;
+            m_scopes[name] += cost;
+            m_total += cost;
+        }
+    }
+
+    // Print the largest entries of the given map, as percentage of the total
+    void dumpTop(std::ostream& os, const std::map<std::string, uint64_t>& costs,
+                 const std::string& what) const {
+        std::vector<std::pair<uint64_t, std::string>> sorted;
+        for (const auto& pair : costs) sorted.emplace_back(pair.second, pair.first);
+        std::stable_sort(sorted.begin(), sorted.end(),
+                         [](const std::pair<uint64_t, std::string>& a,
+                            const std::pair<uint64_t, std::string>& b) {
+                             return a.first > b.first;
+                         });
+        constexpr size_t maxEntries = 5;
+        for (size_t i = 0; i < sorted.size() && i < maxEntries; ++i) {
+            os << "        " << what << " " << std::setw(5) << std::fixed << std::setprecision(1)
+               << (100.0 * sorted[i].first / m_total) << "%  " << sorted[i].second << "\n";
+        }
+    }
+
+public:
+    explicit MTaskSourceCost(const ExecMTask* mtaskp) { addFunc(mtaskp->funcp(), "TOP"); }
+    void dump(std::ostream& os) const {
+        if (!m_total) return;
+        dumpTop(os, m_scopes, "scope");
+        dumpTop(os, m_lines, "line ");
+    }
+};
+
+void reportParallelism(std::ostream& reportOs, AstExecGraph* execGraphp) {
+    // Format into a local stream, so the number formatting does not leak into the report
+    std::ostringstream os;
+    V3Graph& graph = *execGraphp->depGraphp();
+    const auto report = graph.parallelismReport(
+        [](const V3GraphVertex* vtxp) { return vtxp->as<const ExecMTask>()->cost(); });
+    const auto hasProfile = [](const ExecMTask* mtaskp) {
+        return V3Control::getProfileData(v3Global.opt.prefix(), mtaskp->hashName()) != 0;
+    };
+
+    size_t profiled = 0;
+    uint64_t predictEnd = 0;
+    const ExecMTask* startp = nullptr;  // Start of critical path
+    for (const V3GraphVertex& vtx : graph.vertices()) {
+        const ExecMTask* const mtaskp = vtx.as<const ExecMTask>();
+        if (hasProfile(mtaskp)) ++profiled;
+        predictEnd = std::max(predictEnd, mtaskp->predictStart() + mtaskp->cost());
+        if (!startp || mtaskp->priority() > startp->priority()) startp = mtaskp;
+    }
+    const uint32_t nThreads = v3Global.opt.threads();
+    const double speedup
+        = predictEnd ? static_cast<double>(report.totalGraphCost()) / predictEnd : 0.0;
+
+    os << "\nRegion '" << execGraphp->name() << "': " << report.vertexCount() << " mtasks, "
+       << profiled << " with profile data\n";
+    os << std::fixed << std::setprecision(2);
+    os << "  Total cost:          " << report.totalGraphCost() << "\n";
+    os << "  Critical path cost:  " << report.criticalPathCost() << "\n";
+    os << "  Parallelism factor:  " << report.parallelismFactor()
+       << " (upper bound on speedup from any number of threads)\n";
+    os << "  Predicted schedule:  " << predictEnd << " (speedup " << speedup << " on "
+       << nThreads << " threads)\n";
+    if (report.parallelismFactor() < nThreads) {
+        os << "  Scaling is limited by the critical path, not by the thread count\n";
+    }
+
+    // Follow the critical path by always taking the successor with the highest priority
+    os << "\n  Critical path:\n";
+    for (const ExecMTask* mtaskp = startp; mtaskp;) {
+        const double percent
+            = report.criticalPathCost() ? 100.0 * mtaskp->cost() / report.criticalPathCost() : 0;
+        os << "    " << std::setw(8) << std::left << mtaskp->name() << std::right << " cost "
+           << std::setw(10) << mtaskp->cost() << " " << std::setw(5) << std::setprecision(1)
+           << percent << "% of critical path" << (hasProfile(mtaskp) ? "" : " (estimated)")
+           << "\n";
+        MTaskSourceCost{mtaskp}.dump(os);
+        const ExecMTask* nextp = nullptr;
+        for (const V3GraphEdge& edge : mtaskp->outEdges()) {
+            const ExecMTask* const followp = edge.top()->as<const ExecMTask>();
+            if (!nextp || followp->priority() > nextp->priority()) nextp = followp;
+        }
+        mtaskp = nextp;
+    }
+    reportOs << os.str();
+}
+
 void implementExecGraph(AstExecGraph* const execGraphp, const ThreadSchedule& schedule) {
     // Nothing to be done if there are no MTasks in the graph at all.
     if (execGraphp->depGraphp()->empty()) return;
@@ -1140,12 +1258,146 @@ void implementExecGraph(AstExecGraph* const execGraphp, const ThreadSchedule& sc
     addThreadStartToExecGraph(execGraphp, funcps, schedule.id());
 }
 
+// Create an MTask state variable in the top module
+void addMTaskStateVar(const string& name, uint32_t count) {
+    AstNodeModule* const modp = v3Global.rootp()->topModulep();
+    FileLine* const fl = modp->fileline();
+    AstBasicDType* const s_mtaskStateDtypep
+        = v3Global.rootp()->typeTablep()->findBasicDType(fl, VBasicDTypeKwd::MTASKSTATE);
+    AstVar* const varp = new AstVar{fl, VVarType::MODULETEMP, name, s_mtaskStateDtypep};
+    varp->isConst(true);
+    varp->valuep(new AstConst{fl, count});
+    varp->protect(false);  // Do not protect as we have references in text
+    modp->addStmtsp(varp);
+}
+
+// Implement the graph with dynamic scheduling on the thread pool's shared
+// ready queue (--threads-shared-queue). Each MTask becomes a task of its own,
+// which is enqueued by whichever predecessor completes last. As the queue is
+// shared by every model using the pool, independent hierarchical blocks and
+// models fill each other's idle time rather than waiting on static schedules.
+void implementExecGraphShared(AstExecGraph* const execGraphp) {
+    AstScope* const scopep = v3Global.rootp()->topScopep()->scopep();
+    AstNodeModule* const modp = v3Global.rootp()->topModulep();
+    FileLine* const fl = modp->fileline();
+    const string& tag = execGraphp->name();
+    const string finalName = "__Vm_mtaskstate_final__" + tag;
+
+    // Create the entry point of each MTask
+    std::vector<const ExecMTask*> mtaskps;  // In graph order, for stable output
+    std::unordered_map<const ExecMTask*, AstCFunc*> entries;
+    for (const V3GraphVertex& vtx : execGraphp->depGraphp()->vertices()) {
+        const ExecMTask* const mtaskp = vtx.as<const ExecMTask>();
+        mtaskps.push_back(mtaskp);
+        const string name{"__Vtask__" + tag + "__" + cvtToStr(mtaskp->id())};
+        AstCFunc* const funcp = new AstCFunc{fl, name, nullptr, "void"};
+        modp->addStmtsp(funcp);
+        funcp->isStatic(true);  // Uses void self pointer, so static and hand rolled
+        funcp->isLoose(true);
+        funcp->entryPoint(true);
+        funcp->argTypes("void* voidSelf, bool even_cycle");
+        funcp->addStmtsp(new AstCStmt{fl, EmitCUtil::voidSelfAssign(modp)});
+        funcp->addStmtsp(new AstCStmt{fl, EmitCUtil::symClassAssign()});
+        entries.emplace(mtaskp, funcp);
+        if (const uint32_t nDependencies = mtaskp->inEdges().size()) {
+            addMTaskStateVar("__Vm_mtaskstate_" + cvtToStr(mtaskp->id()), nDependencies);
+        }
+    }
+
+    uint32_t nSinks = 0;
+    for (const ExecMTask* const mtaskp : mtaskps) {
+        AstCFunc* const funcp = entries.at(mtaskp);
+        const auto addCStmt = [=](const string& stmt) -> void {  //
+            funcp->addStmtsp(new AstCStmt{fl, stmt});
+        };
+
+        if (v3Global.opt.profPgo()) {
+            // No lock around startCounter, as counter numbers are unique per mtask
+            addCStmt("vlSymsp->_vm_pgoProfiler.startCounter(" + std::to_string(mtaskp->id())
+                     + ");");
+        }
+
+        // Call the MTask function
+        AstCCall* const callp = new AstCCall{fl, mtaskp->funcp()};
+        callp->selfPointer(VSelfPointerText{VSelfPointerText::VlSyms{}, scopep->nameDotless()});
+        callp->dtypeSetVoid();
+        funcp->addStmtsp(callp->makeStmt());
+
+        if (v3Global.opt.profPgo()) {
+            addCStmt("vlSymsp->_vm_pgoProfiler.stopCounter(" + std::to_string(mtaskp->id())
+                     + ");");
+        }
+
+        // Enqueue each dependent MTask that became ready. Successors are
+        // visited in decreasing priority order, so the critical path goes first.
+        std::vector<const ExecMTask*> nextps;
+        for (const V3GraphEdge& edge : mtaskp->outEdges()) {
+            nextps.push_back(edge.top()->as<const ExecMTask>());
+        }
+        std::stable_sort(nextps.begin(), nextps.end(),
+                         [](const ExecMTask* ap, const ExecMTask* bp) {
+                             return ap->priority() > bp->priority();
+                         });
+        for (const ExecMTask* const nextp : nextps) {
+            AstCStmt* const cstmtp = new AstCStmt{fl};
+            funcp->addStmtsp(cstmtp);
+            cstmtp->add("if (vlSelf->__Vm_mtaskstate_" + cvtToStr(nextp->id())
+                        + ".signalUpstreamDone(even_cycle)) {\n");
+            cstmtp->add("vlSymsp->__Vm_threadPoolp->addSharedTask(");
+            cstmtp->add(new AstAddrOfCFunc{fl, entries.at(nextp)});
+            cstmtp->add(", vlSelf, even_cycle);\n}");
+        }
+        if (nextps.empty()) {
+            // Unblock the fake "final" mtask when a sink is finished
+            ++nSinks;
+            addCStmt("vlSelf->" + finalName + ".signalUpstreamDone(even_cycle);");
+        }
+    }
+    addMTaskStateVar(finalName, nSinks);
+
+    // Start the MTasks without dependencies, then help execute the graph
+    for (const ExecMTask* const mtaskp : mtaskps) {
+        if (!mtaskp->inEmpty()) continue;
+        AstCStmt* const cstmtp = new AstCStmt{fl};
+        execGraphp->addStmtsp(cstmtp);
+        cstmtp->add("vlSymsp->__Vm_threadPoolp->addSharedTask(");
+        cstmtp->add(new AstAddrOfCFunc{fl, entries.at(mtaskp)});
+        cstmtp->add(", vlSelf, vlSymsp->__Vm_even_cycle__" + tag + ");");
+    }
+    V3Stats::addStatSum("Optimizations, Thread shared queue tasks",
+                        static_cast<double>(mtaskps.size()));
+
+    const auto addCStmt = [=](const string& stmt) -> void {  //
+        execGraphp->addStmtsp(new AstCStmt{fl, stmt});
+    };
+    if (v3Global.opt.profExec()) {
+        addCStmt("VL_EXEC_TRACE_ADD_RECORD(vlSymsp).threadScheduleWaitBegin();");
+    }
+    addCStmt("vlSymsp->__Vm_threadPoolp->helpUntilDone(vlSelf->" + finalName
+             + ", vlSymsp->__Vm_even_cycle__" + tag + ");");
+    if (v3Global.opt.profExec()) {
+        addCStmt("VL_EXEC_TRACE_ADD_RECORD(vlSymsp).threadScheduleWaitEnd();");
+    }
+}
+
 // Called by Verilator top stage
 void implement(AstNetlist* netlistp) {
     // Gather all ExecGraphs
     std::vector<AstExecGraph*> execGraphps;
     netlistp->topModulep()->foreach([&](AstExecGraph* egp) { execGraphps.emplace_back(egp); });
 
+    std::unique_ptr<std::ofstream> reportp;
+    if (v3Global.opt.reportParallelism()) {
+        const string filename
+            = v3Global.opt.makeDir() + "/" + v3Global.opt.prefix() + "__parallelism.txt";
+        reportp.reset(V3File::new_ofstream(filename));
+        if (reportp->fail()) v3fatal("Can't write file: " << filename);
+        *reportp << "Verilator parallelism report, --threads " << v3Global.opt.threads() << "\n";
+        if (!V3Control::containsMTaskProfileData()) {
+            *reportp << "No mtask profile data, costs are estimates (see --prof-pgo)\n";
+        }
+    }
+
     // Process each
     for (AstExecGraph* const execGraphp : execGraphps) {
         // We can delete the placeholder calls to the MTask functions that
@@ -1182,12 +1434,19 @@ void implement(AstNetlist* netlistp) {
         V3Stats::addStatSum("Optimizations, Thread schedule count",
                             static_cast<double>(packed.size()));
 
+        if (reportp) reportParallelism(*reportp, execGraphp);
+
         // Process MTask function bodies to add additional code
         processMTaskBodies(execGraphp);
 
-        for (const ThreadSchedule& schedule : packed) {
-            // Replace the graph body with its multi-threaded implementation.
-            implementExecGraph(execGraphp, schedule);
+        if (v3Global.opt.threadsSharedQueue()) {
+            // Static schedules above are only used for predicted start times
+            implementExecGraphShared(execGraphp);
+        } else {
+            for (const ThreadSchedule& schedule : packed) {
+                // Replace the graph body with its multi-threaded implementation.
+                implementExecGraph(execGraphp, schedule);
+            }
         }
 
         addThreadEndWrapper(execGraphp);
@@ -47,6 +47,7 @@ private:
     uint32_t m_cost = 0;
     uint64_t m_predictStart = 0;  // Predicted start time of task
     int m_threads = 1;  // Threads used by this mtask
+    uint32_t m_threadId = 0;  // Thread this mtask was scheduled on
     VL_UNCOPYABLE(ExecMTask);
 
     static AstCFunc* createCFunc(AstExecGraph* execGraphp, AstScope* scopep, AstNodeStmt* stmtsp,
@@ -66,6 +67,8 @@ public:
     string hashName() const { return m_hashName; }
     void threads(int threads) { m_threads = threads; }
     int threads() const { return m_threads; }
+    void threadId(uint32_t threadId) { m_threadId = threadId; }
+    uint32_t threadId() const VL_MT_SAFE { return m_threadId; }
     void dump(std::ostream& str) const;
 
     static uint32_t numUsedIds() VL_MT_SAFE { return s_nextId; }
@@ -22,6 +22,9 @@
 //          Note in this case that the widthMin is not correct for the MSW of
 //          the vector.  This must be accounted for if doing later constant
 //          propagation across signals.
+//      Except bitwise operations and compares of whole, large variables,
+//          which are left to the fixed size VL_*_W<words> functions that
+//          the C++ compiler can vectorize (-fwide-simd)
 //
 //*************************************************************************
 
@@ -84,6 +87,7 @@ class ExpandVisitor final : public VNVisitor {
     VDouble0 m_statWides;  // Statistic tracking
     VDouble0 m_statWideWords;  // Statistic tracking
     VDouble0 m_statWideLimited;  // Statistic tracking
+    VDouble0 m_statWideSimd;  // Statistic tracking
 
     // STATE - for current function
     size_t m_nTmps = 0;  // Sequence numbers for temopraries
@@ -108,6 +112,27 @@ class ExpandVisitor final : public VNVisitor {
         }
     }
 
+    // Minimum words in operations kept whole for -fwide-simd, one 256-bit vector
+    static constexpr int WIDE_SIMD_WORDS = 8;
+
+    static bool isWideSimdOperand(const AstNode* nodep) {
+        // Words of constants and selects are better expanded, as they may simplify
+        const AstVarRef* const refp = VN_CAST(nodep, VarRef);
+        return refp && !refp->varp()->user3();
+    }
+    bool keepWideSimd(AstNode* nodep, const AstNode* lhsp, const AstNode* rhsp = nullptr) {
+        // Leave operation unexpanded, for the fixed size VL_*_W<words> functions
+        if (!v3Global.opt.fWideSimd()) return false;
+        if (nodep->widthWords() < WIDE_SIMD_WORDS) return false;
+        // Over the limit is not expanded anyway, and counted as such
+        if (nodep->widthWords() > v3Global.opt.expandLimit()) return false;
+        if (isImpure(nodep)) return false;
+        if (!isWideSimdOperand(lhsp)) return false;
+        if (rhsp && !isWideSimdOperand(rhsp)) return false;
+        ++m_statWideSimd;
+        return true;
+    }
+
     static int longOrQuadWidth(AstNode* nodep) {
         return (nodep->width() + (VL_EDATASIZE - 1)) & ~(VL_EDATASIZE - 1);
     }
@@ -338,6 +363,7 @@ class ExpandVisitor final : public VNVisitor {
     bool expandWide(AstNodeAssign* nodep, AstNot* rhsp) {
         UINFO(8, "    Wordize ASSIGN(NOT) " << nodep);
         // -> {for each_word{ ASSIGN(WORDSEL(wide,#),NOT(WORDSEL(lhs,#))) }}
+        if (keepWideSimd(nodep, rhsp->lhsp())) return false;
         if (!doExpandWide(nodep)) return false;
         FileLine* const fl = rhsp->fileline();
         for (int w = 0; w < nodep->widthWords(); ++w) {
@@ -348,6 +374,7 @@ class ExpandVisitor final : public VNVisitor {
     //-------- Biops
     bool expandWide(AstNodeAssign* nodep, AstAnd* rhsp) {
         UINFO(8, "    Wordize ASSIGN(AND) " << nodep);
+        if (keepWideSimd(nodep, rhsp->lhsp(), rhsp->rhsp())) return false;
         if (!doExpandWide(nodep)) return false;
         FileLine* const fl = nodep->fileline();
         for (int w = 0; w < nodep->widthWords(); ++w) {
@@ -359,6 +386,7 @@ class ExpandVisitor final : public VNVisitor {
     }
     bool expandWide(AstNodeAssign* nodep, AstOr* rhsp) {
         UINFO(8, "    Wordize ASSIGN(OR) " << nodep);
+        if (keepWideSimd(nodep, rhsp->lhsp(), rhsp->rhsp())) return false;
         if (!doExpandWide(nodep)) return false;
         FileLine* const fl = nodep->fileline();
         for (int w = 0; w < nodep->widthWords(); ++w) {
@@ -370,6 +398,7 @@ class ExpandVisitor final : public VNVisitor {
     }
     bool expandWide(AstNodeAssign* nodep, AstXor* rhsp) {
         UINFO(8, "    Wordize ASSIGN(XOR) " << nodep);
+        if (keepWideSimd(nodep, rhsp->lhsp(), rhsp->rhsp())) return false;
         if (!doExpandWide(nodep)) return false;
         FileLine* const fl = nodep->fileline();
         for (int w = 0; w < nodep->widthWords(); ++w) {
@@ -964,6 +993,7 @@ class ExpandVisitor final : public VNVisitor {
         iterateChildren(nodep);
         if (nodep->lhsp()->isWide()) {
             if (isImpure(nodep)) return;
+            if (keepWideSimd(nodep->lhsp(), nodep->lhsp(), nodep->rhsp())) return;
             if (!doExpandWide(nodep->lhsp())) return;
             if (!doExpandWide(nodep->rhsp())) return;
             UINFO(8, "    Wordize EQ/NEQ " << nodep);
@@ -1133,6 +1163,7 @@ public:
         V3Stats::addStat("Optimizations, expand wides", m_statWides);
         V3Stats::addStat("Optimizations, expand wide words", m_statWideWords);
         V3Stats::addStat("Optimizations, expand limited", m_statWideLimited);
+        V3Stats::addStat("Optimizations, expand kept for SIMD", m_statWideSimd);
     }
 };
 
@@ -20,6 +20,7 @@
 
 #include "V3Os.h"
 #include "V3String.h"
+#include "V3ThreadPool.h"
 
 #include <cerrno>
 #include <cstdarg>
@@ -146,6 +147,7 @@ public:
     }
     void writeDepend(const string& filename);
     std::vector<string> getAllDeps() const;
+    std::vector<string> getAllTargets() const;
     void writeTimes(const string& filename, const string& cmdlineIn);
     bool checkTimes(const string& filename, const string& cmdlineIn);
 };
@@ -188,6 +190,14 @@ std::vector<string> V3FileDependImp::getAllDeps() const {
     return r;
 }
 
+std::vector<string> V3FileDependImp::getAllTargets() const {
+    std::vector<string> r;
+    for (const auto& itr : m_filenameList) {
+        if (itr.target()) r.push_back(itr.filename());
+    }
+    return r;
+}
+
 void V3FileDependImp::writeTimes(const string& filename, const string& cmdlineIn) {
     const std::unique_ptr<std::ofstream> ofp{V3File::new_ofstream(filename)};
     if (ofp->fail()) v3fatal("Can't write file: " << filename);
@@ -330,6 +340,7 @@ void V3File::addSrcDepend(const string& filename) VL_MT_SAFE { dependImp.addSrcD
 void V3File::addTgtDepend(const string& filename) VL_MT_SAFE { dependImp.addTgtDepend(filename); }
 void V3File::writeDepend(const string& filename) { dependImp.writeDepend(filename); }
 std::vector<string> V3File::getAllDeps() { return dependImp.getAllDeps(); }
+std::vector<string> V3File::getAllTargets() { return dependImp.getAllTargets(); }
 void V3File::writeTimes(const string& filename, const string& cmdlineIn) {
     dependImp.writeTimes(filename, cmdlineIn);
 }
@@ -360,6 +371,8 @@ class VInFilterImp final {
     using StrList = VInFilter::StrList;
 
     std::map<const std::string, std::string> m_contentsMap;  // Cache of file contents
+    // Contents read ahead by prefetch(), removed when read
+    std::map<const std::string, StrList> m_prefetchMap;
     bool m_readEof = false;  // Received EOF on read
 #ifdef INFILTER_PIPE
     pid_t m_pid = 0;  // fork() process id
@@ -381,11 +394,21 @@ private:
             return readContentsFile(filename, outl);
         }
     }
-    bool readContentsFile(const string& filename, StrList& outl) {
+    static bool readContentsFile(const string& filename, StrList& outl) VL_MT_SAFE {
+        // Must not touch members, as also called from prefetch() threads
         const int fd = open(filename.c_str(), O_RDONLY);
         if (fd < 0) return false;
-        m_readEof = false;
-        readBlocks(fd, -1, outl);
+        char buf[INFILTER_IPC_BUFSIZ];
+        while (true) {
+            const ssize_t got = read(fd, buf, INFILTER_IPC_BUFSIZ);
+            if (got > 0) {
+                outl.push_back(string(buf, got));
+            } else if (got < 0 && errno == EINTR) {
+                continue;
+            } else {
+                break;
+            }
+        }
         close(fd);
         return true;
     }
@@ -602,7 +625,13 @@ protected:
             outl.push_back(it->second);
             return true;
         }
-        if (!readContents(filename, outl)) return false;
+        const auto pit = m_prefetchMap.find(filename);
+        if (pit != m_prefetchMap.end()) {
+            outl.splice(outl.end(), pit->second);
+            m_prefetchMap.erase(pit);
+        } else if (!readContents(filename, outl)) {
+            return false;
+        }
         if (listSize(outl) < INFILTER_CACHE_MAX) {
             // Cache small files (only to save space)
             // It's quite common to `include "timescale" thousands of times
@@ -621,6 +650,31 @@ protected:
         for (const string& i : sl) result += i;
         return result;
     }
+    void prefetch(const std::vector<string>& filenames) {
+        if (m_pid) return;
+        std::vector<string> todo;
+        for (const string& filename : filenames) {
+            if (m_contentsMap.count(filename) || m_prefetchMap.count(filename)) continue;
+            if (std::find(todo.begin(), todo.end(), filename) != todo.end()) continue;
+            todo.push_back(filename);
+        }
+        if (todo.size() < 2) return;
+        std::vector<StrList> contents(todo.size());
+        std::vector<uint8_t> oks(todo.size(), 0);
+        {
+            V3ThreadScope threadScope;
+            for (size_t i = 0; i < todo.size(); ++i) {
+                threadScope.enqueue([&todo, &contents, &oks, i] {
+                    oks[i] = readContentsFile(todo[i], contents[i]);
+                });
+            }
+        }
+        // Unreadable files are left for readWholefile to report in order
+        for (size_t i = 0; i < todo.size(); ++i) {
+            if (oks[i]) m_prefetchMap.emplace(todo[i], std::move(contents[i]));
+        }
+        UINFO(3, "Prefetched " << todo.size() << " files");
+    }
     // CONSTRUCTORS
     explicit VInFilterImp(const string& command) { start(command); }
     ~VInFilterImp() { stop(); }
@@ -639,6 +693,10 @@ bool VInFilter::readWholefile(const string& filename, VInFilter::StrList& outl)
     UASSERT(m_impp, "readWholefile on invalid filter");
     return m_impp->readWholefile(filename, outl);
 }
+void VInFilter::prefetch(const std::vector<string>& filenames) {
+    UASSERT(m_impp, "prefetch on invalid filter");
+    m_impp->prefetch(filenames);
+}
 
 //######################################################################
 // V3OutFormatter: A class for printing code with automatic indentation.
@@ -68,6 +68,7 @@ public:
     static void addTgtDepend(const string& filename) VL_MT_SAFE;
     static void writeDepend(const string& filename);
     static std::vector<string> getAllDeps();
+    static std::vector<string> getAllTargets();
     static void writeTimes(const string& filename, const string& cmdlineIn);
     static bool checkTimes(const string& filename, const string& cmdlineIn);
 
@@ -99,6 +100,9 @@ public:
     // METHODS
     // Read file contents and return it.  Return true on success.
     bool readWholefile(const string& filename, StrList& outl);
+    // Read the given files in parallel, ahead of their readWholefile.
+    // Ignored when using --pipe-filter, as the filter is serial.
+    void prefetch(const std::vector<string>& filenames);
 };
 
 //============================================================================
@@ -166,6 +166,10 @@ public:
                 vVtxp->clearReducibleAndDedupable("SigPublic");
                 vVtxp->setConsumed("SigPublic");
             }
+            if (vscp->varp()->sharedParam()) {
+                // Per-instance value, substituting it would unshare the module code
+                vVtxp->clearReducibleAndDedupable("SharedParam");
+            }
             if (vscp->varp()->isIO() && vscp->scopep()->isTop()) {
                 // We may need to convert to/from sysc/reg sigs
                 vVtxp->setIsTop();
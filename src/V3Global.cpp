@@ -115,7 +115,24 @@ void V3Global::readFiles() {
         V3LibMap::map(v3Global.rootp());
 
         // Read top module
-        for (const auto& filelib : v3Global.opt.vFiles()) {
+        // With --verilate-jobs, file contents are read in parallel batches ahead
+        // of the parse. Preprocessing and parsing remain serial and in order,
+        // as `defines and `timescale carry from one file to the next.
+        const VFileLibList& vFiles = v3Global.opt.vFiles();
+        const size_t prefetchBatch
+            = v3Global.opt.verilateJobs() > 1 ? 16 * v3Global.opt.verilateJobs() : 0;
+        FileLine* const prefetchFlp = new FileLine{FileLine::commandLineFilename()};
+        for (size_t i = 0; i < vFiles.size(); ++i) {
+            if (prefetchBatch && i % prefetchBatch == 0) {
+                std::vector<string> filenames;
+                for (size_t j = i; j < std::min(vFiles.size(), i + prefetchBatch); ++j) {
+                    const string filename
+                        = v3Global.opt.filePath(prefetchFlp, vFiles[j].filename(), "", "");
+                    if (!filename.empty()) filenames.push_back(filename);
+                }
+                filter.prefetch(filenames);
+            }
+            const VFileLibName& filelib = vFiles[i];
             const string& libname = filelib.libname() == "work"
                                         ? v3Global.libMapp()->matchMapping(filelib.filename())
                                         : filelib.libname();
@@ -0,0 +1,186 @@
+// -*- mode: C++; c-file-style: "cc-mode" -*-
+//*************************************************************************
+// DESCRIPTION: Verilator: Compressed sparse row snapshot of a V3Graph
+//
+// Code available from: https://verilator.org
+//
+//*************************************************************************
+//
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of either the GNU Lesser General Public License Version 3
+// or the Perl Artistic License Version 2.0.
+// SPDX-FileCopyrightText: 2003-2026 Wilson Snyder
+// SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+//
+//*************************************************************************
+
+#define VL_MT_DISABLED_CODE_UNIT 1
+
+#include "config_build.h"
+#include "verilatedos.h"
+
+#include "V3GraphCsr.h"
+
+#include "V3Global.h"
+
+#include <algorithm>
+
+VL_DEFINE_DEBUG_FUNCTIONS;
+
+//######################################################################
+// Construction
+
+V3GraphCsr::V3GraphCsr(V3Graph& graph, V3EdgeFuncP edgeFuncp) {
+    // Number the vertices
+    for (V3GraphVertex& vertex : graph.vertices()) {
+        vertex.user(static_cast<uint32_t>(m_vertexps.size()));
+        m_vertexps.push_back(&vertex);
+    }
+    const size_t nVertices = m_vertexps.size();
+    // Out edges, in edge list order
+    m_outBegin.reserve(nVertices + 1);
+    std::vector<uint32_t> inCount(nVertices, 0);
+    for (V3GraphVertex* const vertexp : m_vertexps) {
+        m_outBegin.push_back(static_cast<uint32_t>(m_outs.size()));
+        for (V3GraphEdge& edge : vertexp->outEdges()) {
+            if (!edge.weight() || !edgeFuncp(&edge)) continue;
+            const uint32_t top = edge.top()->user();
+            m_outs.push_back(top);
+            ++inCount[top];
+        }
+    }
+    m_outBegin.push_back(static_cast<uint32_t>(m_outs.size()));
+    // In edges, ordered by source vertex number. Counting sort of the out edges,
+    // avoiding a second walk over the linked edge lists.
+    m_inBegin.resize(nVertices + 1);
+    uint32_t total = 0;
+    for (size_t i = 0; i < nVertices; ++i) {
+        m_inBegin[i] = total;
+        total += inCount[i];
+    }
+    m_inBegin[nVertices] = total;
+    m_ins.resize(total);
+    std::vector<uint32_t>& nextIn = inCount;  // Reuse as fill position
+    for (size_t i = 0; i < nVertices; ++i) nextIn[i] = m_inBegin[i];
+    for (uint32_t from = 0; from < nVertices; ++from) {
+        for (const uint32_t to : outs(from)) m_ins[nextIn[to]++] = from;
+    }
+    m_visited.resize(nVertices, 0);
+}
+
+//######################################################################
+// Algorithms - strongly connected
+// Changes color()
+
+void V3GraphCsr::stronglyConnected() {
+    // Pearce's algorithm, as GraphAlgStrongly, with an explicit stack in place of
+    // recursion, so it handles very deep graphs. Vertices are visited in the same
+    // order, so the resulting colors are identical.
+    const size_t nVertices = size();
+    std::vector<uint32_t> low(nVertices, 0);  // DFS number of possible root, 0=not iterated
+    std::vector<uint32_t> color(nVertices, 0);  // Component number when fully processed
+    std::vector<uint32_t> callTrace;  // Vertices waiting for their component root
+    struct Frame final {
+        uint32_t m_vtx;  // Vertex being iterated
+        uint32_t m_dfsNum;  // DFS number of that vertex
+        const uint32_t* m_nextp;  // Next out edge to consider
+    };
+    std::vector<Frame> stack;
+    uint32_t currentDfs = 0;
+
+    const auto enter = [&](uint32_t vtx) {
+        const uint32_t dfsNum = currentDfs++;
+        low[vtx] = dfsNum;
+        stack.push_back({vtx, dfsNum, outs(vtx).begin()});
+    };
+
+    for (uint32_t root = 0; root < nVertices; ++root) {
+        if (low[root]) continue;
+        ++currentDfs;
+        enter(root);
+        while (!stack.empty()) {
+            Frame& frame = stack.back();
+            const uint32_t vtx = frame.m_vtx;
+            if (frame.m_nextp != outs(vtx).end()) {
+                const uint32_t top = *frame.m_nextp;
+                if (!low[top]) {
+                    // Dest not computed yet, the edge is reconsidered once it is
+                    enter(top);
+                    continue;
+                }
+                if (!color[top] && low[vtx] > low[top]) low[vtx] = low[top];
+                ++frame.m_nextp;
+                continue;
+            }
+            const uint32_t dfsNum = frame.m_dfsNum;
+            stack.pop_back();
+            if (low[vtx] == dfsNum) {  // New head of subtree
+                color[vtx] = dfsNum;
+                while (!callTrace.empty() && low[callTrace.back()] >= dfsNum) {
+                    color[callTrace.back()] = dfsNum;
+                    callTrace.pop_back();
+                }
+            } else {  // In another subtree (maybe...)
+                callTrace.push_back(vtx);
+            }
+        }
+    }
+
+    // If there's a single vertex of a color, it doesn't need a subgraph
+    for (uint32_t vtx = 0; vtx < nVertices; ++vtx) {
+        bool onecolor = true;
+        for (const uint32_t top : outs(vtx)) {
+            if (color[vtx] == color[top]) {
+                onecolor = false;
+                break;
+            }
+        }
+        m_vertexps[vtx]->color(onecolor ? 0 : color[vtx]);
+    }
+}
+
+//######################################################################
+// Algorithms - topological order
+
+std::vector<uint32_t> V3GraphCsr::topologicalOrder() const {
+    const size_t nVertices = size();
+    std::vector<uint32_t> result;
+    result.reserve(nVertices);
+    std::vector<uint32_t> pending(nVertices);  // Number of unprocessed inputs
+    for (uint32_t vtx = 0; vtx < nVertices; ++vtx) {
+        pending[vtx] = static_cast<uint32_t>(ins(vtx).size());
+        if (!pending[vtx]) result.push_back(vtx);
+    }
+    // 'result' doubles as the work queue
+    for (size_t i = 0; i < result.size(); ++i) {
+        for (const uint32_t top : outs(result[i])) {
+            if (!--pending[top]) result.push_back(top);
+        }
+    }
+    return result;
+}
+
+//######################################################################
+// Algorithms - reachability
+
+bool V3GraphCsr::pathExists(uint32_t from, uint32_t to) const {
+    if (from == to) return true;
+    if (++m_generation == 0) {  // Wrapped, so clear stale marks
+        std::fill(m_visited.begin(), m_visited.end(), 0);
+        m_generation = 1;
+    }
+    std::vector<uint32_t> stack;
+    stack.push_back(from);
+    m_visited[from] = m_generation;
+    while (!stack.empty()) {
+        const uint32_t vtx = stack.back();
+        stack.pop_back();
+        for (const uint32_t top : outs(vtx)) {
+            if (top == to) return true;
+            if (m_visited[top] == m_generation) continue;
+            m_visited[top] = m_generation;
+            stack.push_back(top);
+        }
+    }
+    return false;
+}
@@ -0,0 +1,104 @@
+// -*- mode: C++; c-file-style: "cc-mode" -*-
+//*************************************************************************
+// DESCRIPTION: Verilator: Compressed sparse row snapshot of a V3Graph
+//
+// Code available from: https://verilator.org
+//
+//*************************************************************************
+//
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of either the GNU Lesser General Public License Version 3
+// or the Perl Artistic License Version 2.0.
+// SPDX-FileCopyrightText: 2003-2026 Wilson Snyder
+// SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+//
+//*************************************************************************
+
+#ifndef VERILATOR_V3GRAPHCSR_H_
+#define VERILATOR_V3GRAPHCSR_H_
+
+#include "config_build.h"
+#include "verilatedos.h"
+
+#include "V3Graph.h"
+
+#include <vector>
+
+//============================================================================
+// A frozen, read only copy of the structure of a V3Graph, for algorithms that
+// only traverse the graph. Vertices are numbered 0..size()-1 in graph order,
+// and the out/in edges of each vertex are stored as contiguous arrays of
+// vertex numbers, rather than as linked lists of heap allocated edges. Edges
+// are kept in their original order, so algorithms visit the graph in the same
+// order as the equivalent V3Graph algorithm.
+//
+// The graph must not change while the snapshot is in use.
+
+class V3GraphCsr final {
+public:
+    // A range of vertex numbers
+    class Range final {
+        const uint32_t* const m_beginp;
+        const uint32_t* const m_endp;
+
+    public:
+        Range(const uint32_t* beginp, const uint32_t* endp)
+            : m_beginp{beginp}
+            , m_endp{endp} {}
+        const uint32_t* begin() const { return m_beginp; }
+        const uint32_t* end() const { return m_endp; }
+        size_t size() const { return m_endp - m_beginp; }
+        bool empty() const { return m_beginp == m_endp; }
+    };
+
+private:
+    // MEMBERS
+    std::vector<V3GraphVertex*> m_vertexps;  // Vertex number -> vertex
+    std::vector<uint32_t> m_outBegin;  // Vertex number -> first index in m_outs, plus end
+    std::vector<uint32_t> m_outs;  // Destination vertex numbers of all out edges
+    std::vector<uint32_t> m_inBegin;  // Vertex number -> first index in m_ins, plus end
+    std::vector<uint32_t> m_ins;  // Source vertex numbers of all in edges
+    mutable std::vector<uint32_t> m_visited;  // Vertex number -> generation last visited
+    mutable uint32_t m_generation = 0;  // Current visit generation
+
+public:
+    // CONSTRUCTORS
+    // Snapshot all vertices, and the edges with non-zero weight that edgeFuncp
+    // accepts (the edges GraphAlg::followEdge would follow).
+    // Side-effect: changes user() to the vertex number
+    explicit V3GraphCsr(V3Graph& graph,
+                        V3EdgeFuncP edgeFuncp = &V3GraphEdge::followAlwaysTrue) VL_MT_DISABLED;
+    ~V3GraphCsr() = default;
+    VL_UNCOPYABLE(V3GraphCsr);
+
+    // ACCESSORS
+    size_t size() const { return m_vertexps.size(); }
+    size_t edgeCount() const { return m_outs.size(); }
+    V3GraphVertex* vertexp(uint32_t num) const { return m_vertexps[num]; }
+    // Vertex number of a vertex, valid until its user() is changed
+    static uint32_t num(const V3GraphVertex* vertexp) { return vertexp->user(); }
+    Range outs(uint32_t num) const {
+        return {m_outs.data() + m_outBegin[num], m_outs.data() + m_outBegin[num + 1]};
+    }
+    Range ins(uint32_t num) const {
+        return {m_ins.data() + m_inBegin[num], m_ins.data() + m_inBegin[num + 1]};
+    }
+
+    // METHODS - ALGORITHMS
+
+    /// Assign same color to all vertices that are strongly connected, with
+    /// the same result as V3Graph::stronglyConnected, but without recursion.
+    /// Side-effect: changes color() of the graph vertices
+    void stronglyConnected() VL_MT_DISABLED;
+
+    /// Return vertex numbers in topological order, breadth first from the
+    /// vertices with no inputs. If the graph has a cycle, the vertices on or
+    /// after the cycle are missing from the result.
+    std::vector<uint32_t> topologicalOrder() const VL_MT_DISABLED;
+
+    /// Return true if there is a path from vertex 'from' to vertex 'to'
+    /// (or if they are the same vertex)
+    bool pathExists(uint32_t from, uint32_t to) const VL_MT_DISABLED;
+};
+
+#endif  // Guard
@@ -21,6 +21,8 @@
 
 #include "V3Global.h"
 #include "V3Graph.h"
+#include "V3GraphCsr.h"
+#include "V3GraphPathChecker.h"
 
 VL_DEFINE_DEBUG_FUNCTIONS;
 
@@ -267,6 +269,94 @@ public:
 
 //======================================================================
 
+class V3GraphTestCsr final : public V3GraphTest {
+    // Compare V3GraphCsr against the linked V3Graph algorithms on a larger graph,
+    // and report the time taken by each (visible with --debugi-V3GraphTest 2)
+    static constexpr uint32_t WIDTH = 100;  // Vertices per layer
+    static constexpr uint32_t LAYERS = 200;  // Number of layers
+    uint64_t m_rand = 1;  // Pseudo-random state, fixed so runs are repeatable
+
+    uint32_t randomBelow(uint32_t range) {
+        m_rand = m_rand * 6364136223846793005ULL + 1442695040888963407ULL;
+        return static_cast<uint32_t>(m_rand >> 33) % range;
+    }
+
+public:
+    string name() override { return "csr"; }
+    void runTest() override {
+        V3Graph* const gp = &m_graph;
+        // Layered graph, edges go forward to the next layers, plus back edges making loops
+        std::vector<V3GraphTestVertex*> vtxps;
+        for (uint32_t i = 0; i < WIDTH * LAYERS; ++i) {
+            vtxps.push_back(new V3GraphTestVertex{gp, "v" + cvtToStr(i)});
+        }
+        std::vector<V3GraphEdge*> backEdgeps;
+        for (uint32_t i = 0; i < WIDTH * (LAYERS - 3); ++i) {
+            for (int n = 0; n < 3; ++n) {
+                new V3GraphEdge{gp, vtxps[i], vtxps[i + WIDTH + randomBelow(WIDTH * 2)], 1, true};
+            }
+            if (i > WIDTH * 2 && randomBelow(50) == 0) {
+                backEdgeps.push_back(
+                    new V3GraphEdge{gp, vtxps[i], vtxps[i - WIDTH - randomBelow(WIDTH)], 1, true});
+            }
+        }
+
+        // Strongly connected components must be identical
+        VlOs::DeltaWallTime listTime{true};
+        gp->stronglyConnected(&V3GraphEdge::followAlwaysTrue);
+        const double listSecs = listTime.deltaTime();
+        std::vector<uint32_t> listColors;
+        for (const V3GraphVertex& vtx : gp->vertices()) listColors.push_back(vtx.color());
+        VlOs::DeltaWallTime csrTime{true};
+        V3GraphCsr csr{*gp};
+        const double buildSecs = csrTime.deltaTime();
+        csr.stronglyConnected();
+        const double csrSecs = csrTime.deltaTime();
+        size_t i = 0;
+        for (const V3GraphVertex& vtx : gp->vertices()) {
+            UASSERT(vtx.color() == listColors[i++], "SelfTest: CSR SCC colors differ");
+        }
+        UINFO(2, "  SCC " << csr.size() << " vertices " << csr.edgeCount() << " edges: list "
+                          << listSecs << "s, csr " << buildSecs << "s build + " << csrSecs
+                          << "s");
+
+        // Reachability must match GraphPathChecker, which requires an acyclic graph
+        for (V3GraphEdge* const edgep : backEdgeps) VL_DO_DANGLING(edgep->unlinkDelete(), edgep);
+        V3GraphCsr dag{*gp};
+        const std::vector<uint32_t> order = dag.topologicalOrder();
+        UASSERT(order.size() == dag.size(), "SelfTest: CSR topological order incomplete");
+        std::vector<uint32_t> position(dag.size());
+        for (uint32_t n = 0; n < order.size(); ++n) position[order[n]] = n;
+        for (uint32_t from = 0; from < dag.size(); ++from) {
+            for (const uint32_t to : dag.outs(from)) {
+                UASSERT(position[from] < position[to], "SelfTest: CSR topological order wrong");
+            }
+        }
+        std::vector<std::pair<uint32_t, uint32_t>> queries;
+        for (int n = 0; n < 1000; ++n) {
+            queries.emplace_back(randomBelow(WIDTH * 4), WIDTH * 4 + randomBelow(WIDTH * 8));
+        }
+        std::vector<bool> csrResults;
+        VlOs::DeltaWallTime csrPathTime{true};
+        for (const auto& query : queries) {
+            csrResults.push_back(dag.pathExists(query.first, query.second));
+        }
+        const double csrPathSecs = csrPathTime.deltaTime();
+        VlOs::DeltaWallTime listPathTime{true};
+        GraphPathChecker checker{gp};
+        size_t q = 0;
+        for (const auto& query : queries) {
+            UASSERT(checker.pathExistsFrom(vtxps[query.first], vtxps[query.second])
+                        == csrResults[q++],
+                    "SelfTest: CSR reachability differs");
+        }
+        const double listPathSecs = listPathTime.deltaTime();
+        UINFO(2, "  Reachability " << queries.size() << " queries: list " << listPathSecs
+                                   << "s, csr " << csrPathSecs << "s");
+        dumpSelf();
+    }
+};
+
 class V3GraphTestImport final : public V3GraphTest {
 
 #ifdef GRAPH_IMPORT
@@ -302,5 +392,6 @@ void V3Graph::selfTest() {
     { V3GraphTestStrong{}.run(); }
     { V3GraphTestAcyc{}.run(); }
     { V3GraphTestVars{}.run(); }
+    { V3GraphTestCsr{}.run(); }
     { V3GraphTestImport{}.run(); }
 }
@@ -91,10 +91,12 @@
 #include "V3Control.h"
 #include "V3EmitV.h"
 #include "V3File.h"
+#include "V3InstrCount.h"
 #include "V3Os.h"
 #include "V3Stats.h"
 #include "V3String.h"
 
+#include <iomanip>
 #include <memory>
 #include <sstream>
 #include <utility>
@@ -397,6 +399,201 @@ public:
     }
 };
 
+//######################################################################
+// Choose hierarchical blocks automatically, see --hierarchical-auto
+
+class HierBlockAutoVisitor final : public VNVisitorConst {
+    // NODE STATE
+    // AstVar::user1p()            -> AstNodeModule*. Module declaring the variable
+    // AstNodeFTask::user1p()      -> AstNodeModule*. Module declaring the task
+    const VNUser1InUse m_inuser1;
+
+    // TYPES
+    struct ModInfo final {
+        std::vector<AstNodeModule*> m_cellsp;  // Module of each instance under this module
+        std::vector<AstNodeModule*> m_parentsp;  // Modules instantiating this module
+        uint64_t m_ownCost = 0;  // Estimated instructions in this module itself
+        uint64_t m_flatCost = 0;  // Cost if all instances under this module were flattened
+        uint64_t m_blockCost = 0;  // Cost excluding that of hierarchical blocks under it
+        uint64_t m_pathCost = 0;  // Build critical path cost through this module
+        uint64_t m_instances = 0;  // Instances in the whole design
+        bool m_ineligible = false;  // Cannot be a hierarchical block
+    };
+
+    // Minimum estimated cost of a block, else the Verilation overhead dominates
+    static constexpr uint64_t MIN_BLOCK_COST = 10000;
+    // Build jobs to size blocks for without --build-jobs, not the processors of this
+    // host, so the chosen blocks are the same on every machine
+    static constexpr unsigned DEFAULT_BUILD_JOBS = 8;
+
+    // STATE
+    std::unordered_map<const AstNodeModule*, ModInfo> m_modInfo;  // Per module information
+    std::vector<AstNodeModule*> m_modsp;  // All modules, in level order
+    std::vector<std::pair<AstNodeModule*, AstNode*>> m_xrefs;  // Module, target of dotted refs
+    AstNodeModule* m_modp = nullptr;  // Current module
+
+    // METHODS
+    void markIneligible(AstNodeModule* modp) {
+        // A dotted reference may pass through any module above the referenced module
+        ModInfo& info = m_modInfo[modp];
+        if (info.m_ineligible) return;
+        info.m_ineligible = true;
+        for (AstNodeModule* const parentp : info.m_parentsp) markIneligible(parentp);
+    }
+    static bool isBlockCandidate(const AstNodeModule* nodep) {
+        const AstModule* const modp = VN_CAST(nodep, Module);
+        if (!modp) return false;
+        if (modp->isTop() || modp->isChecker() || modp->isProgram()) return false;
+        if (modp->hasGenericIface() || modp->modPublic() || modp->inLibrary()) return false;
+        // Modules specialized by V3Param are named differently from explicit hier_block
+        // modules, so only modules with their original parameters are chosen
+        return modp->name() == modp->origName();
+    }
+
+    // VISITORS
+    void visit(AstNodeModule* nodep) override {
+        VL_RESTORER(m_modp);
+        m_modp = nodep;
+        m_modsp.push_back(nodep);
+        m_modInfo[nodep];
+        iterateChildrenConst(nodep);
+    }
+    void visit(AstCell* nodep) override {
+        m_modInfo[m_modp].m_cellsp.push_back(nodep->modp());
+        m_modInfo[nodep->modp()].m_parentsp.push_back(m_modp);
+        iterateChildrenConst(nodep);
+    }
+    void visit(AstVar* nodep) override {
+        if (m_modp) nodep->user1p(m_modp);
+        // Interface ports cannot be hierarchical block ports
+        if (m_modp && nodep->isIfaceRef() && !nodep->isIfaceParent()) {
+            m_modInfo[m_modp].m_ineligible = true;
+        }
+    }
+    void visit(AstNodeFTask* nodep) override {
+        if (m_modp) nodep->user1p(m_modp);
+        if (m_modp && nodep->dpiExport()) m_modInfo[m_modp].m_ineligible = true;
+        iterateChildrenConst(nodep);
+    }
+    void visit(AstVarXRef* nodep) override {
+        if (m_modp) m_xrefs.emplace_back(m_modp, nodep->varp());
+    }
+    void visit(AstNodeFTaskRef* nodep) override {
+        if (m_modp && !nodep->dotted().empty()) m_xrefs.emplace_back(m_modp, nodep->taskp());
+        iterateChildrenConst(nodep);
+    }
+    void visit(AstConstPool*) override {}  // Accelerate
+    void visit(AstTypeTable*) override {}  // Accelerate
+    void visit(AstNode* nodep) override { iterateChildrenConst(nodep); }
+
+    // CONSTRUCTOR
+    explicit HierBlockAutoVisitor(AstNetlist* netlistp) {
+        iterateChildrenConst(netlistp);
+        // Both ends of a dotted reference must be in the same Verilation
+        for (const auto& pair : m_xrefs) {
+            markIneligible(pair.first);
+            if (!pair.second) continue;
+            if (AstNodeModule* const targetModp = VN_CAST(pair.second->user1p(), NodeModule)) {
+                markIneligible(targetModp);
+            }
+        }
+
+        // Count instances, top down
+        AstNodeModule* const topModp = netlistp->topModulep();
+        m_modInfo[topModp].m_instances = 1;
+        for (AstNodeModule* const modp : m_modsp) {
+            const ModInfo& info = m_modInfo[modp];
+            for (AstNodeModule* const cellModp : info.m_cellsp) {
+                m_modInfo[cellModp].m_instances += info.m_instances;
+            }
+        }
+
+        // Estimate costs, bottom up
+        for (auto it = m_modsp.rbegin(); it != m_modsp.rend(); ++it) {
+            AstNodeModule* const modp = *it;
+            ModInfo& info = m_modInfo[modp];
+            info.m_ownCost = V3InstrCount::count(modp, false);
+            info.m_flatCost = info.m_ownCost;
+            for (AstNodeModule* const cellModp : info.m_cellsp) {
+                info.m_flatCost += m_modInfo[cellModp].m_flatCost;
+            }
+        }
+        const uint64_t totalCost = m_modInfo[topModp].m_flatCost;
+
+        // Size blocks so that there are about twice as many as build jobs
+        const unsigned jobs = v3Global.opt.buildJobsSet()
+                                  ? std::max(static_cast<unsigned>(v3Global.opt.buildJobs()), 1U)
+                                  : DEFAULT_BUILD_JOBS;
+        uint64_t threshold = totalCost / (2 * jobs);
+        if (threshold < MIN_BLOCK_COST) threshold = MIN_BLOCK_COST;
+
+        // Choose blocks bottom up, so a block's cost excludes that of blocks under it.
+        // Each block is Verilated once however many instances it has, so
+        // frequently instantiated modules are preferred.
+        std::vector<const AstNodeModule*> chosenp;
+        uint64_t sumBlockCost = 0;
+        for (auto it = m_modsp.rbegin(); it != m_modsp.rend(); ++it) {
+            AstNodeModule* const modp = *it;
+            ModInfo& info = m_modInfo[modp];
+            info.m_blockCost = info.m_ownCost;
+            uint64_t childPathCost = 0;
+            for (AstNodeModule* const cellModp : info.m_cellsp) {
+                const ModInfo& cellInfo = m_modInfo[cellModp];
+                if (!cellModp->hierBlock()) info.m_blockCost += cellInfo.m_blockCost;
+                childPathCost = std::max(childPathCost, cellInfo.m_pathCost);
+            }
+            if (!modp->hierBlock() && !info.m_ineligible && isBlockCandidate(modp)
+                && info.m_blockCost >= MIN_BLOCK_COST
+                && info.m_blockCost * info.m_instances >= threshold) {
+                UINFO(4, "Automatic hierarchical block " << modp);
+                modp->hierBlock(true);
+                chosenp.push_back(modp);
+            }
+            info.m_pathCost = childPathCost;
+            if (modp->hierBlock() || modp == topModp) {
+                info.m_pathCost += info.m_blockCost;
+                sumBlockCost += info.m_blockCost;
+            }
+        }
+        V3Stats::addStat("HierBlock, Automatic hierarchical blocks", chosenp.size());
+
+        // Blocks build in parallel, limited by the longest chain of nested blocks
+        const uint64_t hierCost
+            = std::max(m_modInfo[topModp].m_pathCost, sumBlockCost / jobs);
+        report(chosenp, jobs, threshold, totalCost, hierCost);
+    }
+
+    void report(const std::vector<const AstNodeModule*>& chosenp, unsigned jobs,
+                uint64_t threshold, uint64_t totalCost, uint64_t hierCost) {
+        const string filename
+            = v3Global.opt.makeDir() + "/" + v3Global.opt.prefix() + "__hierAuto.txt";
+        const std::unique_ptr<std::ofstream> ofp{V3File::new_ofstream(filename)};
+        if (ofp->fail()) v3fatal("Can't write file: " << filename);
+        std::ostream& os = *ofp;
+        os << "Automatic hierarchical blocks (from --hierarchical-auto)\n\n";
+        os << "Costs are estimated instruction counts, relative to each other.\n\n";
+        os << "  Build jobs:                    " << jobs << "\n";
+        os << "  Block cost threshold:          " << threshold << "\n";
+        os << "  Blocks chosen:                 " << chosenp.size() << "\n\n";
+        os << "  " << std::setw(12) << "Cost" << "  " << std::setw(10) << "Instances"
+           << "  " << std::setw(12) << "Flat cost" << "  Module\n";
+        for (const AstNodeModule* const modp : chosenp) {
+            const ModInfo& info = m_modInfo[modp];
+            os << "  " << std::setw(12) << info.m_blockCost << "  " << std::setw(10)
+               << info.m_instances << "  " << std::setw(12)
+               << info.m_flatCost * info.m_instances << "  " << modp->prettyName() << "\n";
+        }
+        os << "\nPredicted Verilation and compile time, relative to without blocks:\n";
+        os << std::fixed << std::setprecision(2);
+        os << "  Without hierarchical blocks:   1.00\n";
+        os << "  With hierarchical blocks:      "
+           << (totalCost ? static_cast<double>(hierCost) / totalCost : 1.0) << "\n";
+    }
+
+public:
+    static void apply(AstNetlist* netlistp) { HierBlockAutoVisitor{netlistp}; }
+};
+
 void V3HierGraph::writeCommandArgsFiles(bool forMkJson) const {
 
     for (const V3GraphVertex& vtx : vertices()) {
@@ -455,6 +652,7 @@ void V3Hierarchical::createGraph(AstNetlist* netlistp) {
                                     + "... Suggest remove verilator hier_block on this module");
         modp->hierBlock(false);
     }
+    if (v3Global.opt.hierarchicalAuto()) HierBlockAutoVisitor::apply(netlistp);
 
     V3HierGraph* const graphp = HierBlockUsageCollectVisitor::apply(netlistp);
     V3Stats::addStat("HierBlock, Hierarchical blocks", graphp->vertices().size());
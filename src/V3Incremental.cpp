@@ -0,0 +1,301 @@
+// -*- mode: C++; c-file-style: "cc-mode" -*-
+//*************************************************************************
+// DESCRIPTION: Verilator: Skip Verilation of unchanged designs
+//
+// Code available from: https://verilator.org
+//
+//*************************************************************************
+//
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of either the GNU Lesser General Public License Version 3
+// or the Perl Artistic License Version 2.0.
+// SPDX-FileCopyrightText: 2003-2026 Wilson Snyder
+// SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+//
+//*************************************************************************
+// V3Incremental's Transformations:
+//
+//  After linking and parameterization, hash the JSON dump of the netlist,
+//  along with the Verilator version and the command line. This covers
+//  every module reachable from the top, with its parameters, but not
+//  comments, whitespace, or unused modules in the sources. Control files,
+//  and sources with `verilator_config sections, hold data outside the
+//  netlist, e.g. profile_data, so their contents are hashed too.
+//
+//  If the hash matches that recorded by the previous run, and all files
+//  that run wrote still exist, the rest of Verilation would produce the
+//  same output, so is skipped.
+//
+//  With --hierarchical each block is Verilated by its own run, so an edit
+//  to a module only re-Verilates the blocks containing it.
+//
+//  With --verilate-cache, after parsing, hash the command line, including
+//  -f files, and the contents of all sources read. The outputs of a run
+//  are copied into the cache directory under that hash, and a later run
+//  with the same hash copies them back instead of Verilating. As with
+//  ccache, this shares results between builds, e.g. of each hierarchical
+//  block across branches.
+//
+//*************************************************************************
+
+#include "V3PchAstNoMT.h"  // VL_MT_DISABLED_CODE_UNIT
+
+#include "V3Incremental.h"
+
+#include "V3File.h"
+#include "V3Os.h"
+
+#include <array>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <sstream>
+#include <sys/stat.h>
+
+VL_DEFINE_DEBUG_FUNCTIONS;
+
+std::string V3Incremental::s_digest;
+std::string V3Incremental::s_cacheKey;
+
+//######################################################################
+// Stream buffer feeding a hash, so the dump is never held in memory
+
+class IncrementalHashBuf final : public std::streambuf {
+    VHashSha256& m_hash;  // Hash being computed
+    std::array<char, 64 * 1024> m_buf;  // Pending data
+
+    void flushBuf() {
+        if (pptr() != pbase()) m_hash.insert(pbase(), pptr() - pbase());
+        setp(m_buf.data(), m_buf.data() + m_buf.size());
+    }
+
+public:
+    explicit IncrementalHashBuf(VHashSha256& hash)
+        : m_hash{hash} {
+        setp(m_buf.data(), m_buf.data() + m_buf.size());
+    }
+    ~IncrementalHashBuf() override { flushBuf(); }
+
+protected:
+    int_type overflow(int_type ch) override {
+        flushBuf();
+        if (!traits_type::eq_int_type(ch, traits_type::eof())) {
+            *pptr() = traits_type::to_char_type(ch);
+            pbump(1);
+        }
+        return traits_type::not_eof(ch);
+    }
+    int sync() override {
+        flushBuf();
+        return 0;
+    }
+};
+
+//######################################################################
+// V3Incremental
+
+// Return true if the file may hold control data, which is not in the netlist
+static bool incrementalHasControl(const string& filename) {
+    if (VString::endsWith(filename, ".vlt")) return true;
+    const std::unique_ptr<std::ifstream> ifp{
+        new std::ifstream{filename.c_str(), std::ios::binary}};
+    const string contents{std::istreambuf_iterator<char>{*ifp}, std::istreambuf_iterator<char>{}};
+    return contents.find("`verilator_config") != string::npos;
+}
+
+static string incrementalFilename() {
+    return v3Global.opt.hierTopDataDir() + "/" + v3Global.opt.prefix() + "__verIncr.dat";
+}
+
+bool V3Incremental::checkUnchanged(AstNetlist* nodep) {
+    UINFO(2, __FUNCTION__ << ":");
+    if (!v3Global.opt.jsonIds()) {
+        // Dump would contain node addresses, so never matches
+        UINFO(1, "--incremental: Ignored with --no-json-ids");
+        return false;
+    }
+    {
+        VHashSha256 hash;
+        {
+            IncrementalHashBuf buf{hash};
+            std::ostream os{&buf};
+            os << V3Options::version() << '\n';
+            os << v3Global.opt.allArgsString() << '\n';
+            FileLine::fileNameNumMapDumpJson(os);
+            nodep->dumpTreeJson(os);
+            for (const string& filename : V3File::getAllDeps()) {
+                // The binary is covered by the version, and is large to hash
+                if (filename == v3Global.opt.buildDepBin()) continue;
+                if (!incrementalHasControl(filename)) continue;
+                VHashSha256 fileHash;
+                fileHash.insertFile(filename);
+                os << filename << ' ' << fileHash.digestSymbol() << '\n';
+            }
+        }
+        s_digest = hash.digestSymbol();
+    }
+    UINFO(2, "   --incremental: digest " << s_digest);
+
+    const string filename = incrementalFilename();
+    const std::unique_ptr<std::ifstream> ifp{V3File::new_ifstream_nodepend(filename)};
+    if (ifp->fail()) {
+        UINFO(2, "   --incremental: no input " << filename);
+        return false;
+    }
+    V3Os::getline(*ifp);  // Description
+    bool sawTarget = false;
+    while (!ifp->eof()) {
+        const string line = V3Os::getline(*ifp);
+        if (line.size() < 3) continue;
+        const string value = line.substr(2);
+        if (line[0] == 'H') {
+            if (value != s_digest) {
+                UINFO(2, "   --incremental: netlist differs from " << value);
+                return false;
+            }
+        } else if (line[0] == 'T') {
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-type-member-init)
+            struct stat curStat;
+            if (stat(value.c_str(), &curStat) != 0) {
+                UINFO(2, "   --incremental: missing " << value);
+                return false;
+            }
+            sawTarget = true;
+        }
+    }
+    return sawTarget;
+}
+
+void V3Incremental::writeDigest() {
+    if (s_digest.empty()) return;  // Not hashed, e.g. --lint-only
+    const string filename = incrementalFilename();
+    const std::unique_ptr<std::ofstream> ofp{V3File::new_ofstream_nodepend(filename)};
+    if (ofp->fail()) v3fatal("Can't write file: " << filename);
+    *ofp << "# DESCR"
+         << "IPTION: Verilator output: Netlist hash for --incremental.  Delete at will.\n";
+    *ofp << "H " << s_digest << "\n";
+    for (const string& target : V3File::getAllTargets()) {
+        if (target == filename) continue;
+        *ofp << "T " << target << "\n";
+    }
+}
+
+//######################################################################
+// Cache
+
+static bool cacheCopyFile(const string& fromFilename, const string& toFilename) {
+    const std::unique_ptr<std::ifstream> ifp{
+        new std::ifstream{fromFilename.c_str(), std::ios::binary}};
+    if (ifp->fail()) return false;
+    const std::unique_ptr<std::ofstream> ofp{
+        new std::ofstream{toFilename.c_str(), std::ios::binary}};
+    if (ofp->fail()) return false;
+    *ofp << ifp->rdbuf();
+    return !ofp->fail();
+}
+
+static bool cacheSameFile(const string& filename1, const string& filename2) {
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-member-init)
+    struct stat stat1;
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-member-init)
+    struct stat stat2;
+    if (stat(filename1.c_str(), &stat1) != 0 || stat(filename2.c_str(), &stat2) != 0) {
+        return false;
+    }
+    if (stat1.st_size != stat2.st_size) return false;
+    VHashSha256 hash1;
+    hash1.insertFile(filename1);
+    VHashSha256 hash2;
+    hash2.insertFile(filename2);
+    return hash1.digestSymbol() == hash2.digestSymbol();
+}
+
+static bool cacheEnabled() {
+    // With --hierarchical, the first run only plans the block runs, which are cached
+    return !v3Global.opt.verilateCache().empty() && !v3Global.opt.hierarchical()
+           && !v3Global.opt.lintOnly() && !v3Global.opt.preprocOnly();
+}
+
+bool V3Incremental::restoreCached(const string& argString) {
+    if (!cacheEnabled()) return false;
+    // Warnings would not be repeated
+    if (V3Error::isErrorOrWarn()) return false;
+    {
+        VHashSha256 hash;
+        hash.insert(V3Options::version() + "\n" + argString + "\n");
+        for (const string& filename : V3File::getAllDeps()) {
+            // The binary is covered by the version, and is large to hash
+            if (filename == v3Global.opt.buildDepBin()) continue;
+            VHashSha256 fileHash;
+            fileHash.insertFile(filename);
+            hash.insert(filename + " " + fileHash.digestSymbol() + "\n");
+        }
+        s_cacheKey = hash.digestSymbol();
+    }
+    const string entryDir = v3Global.opt.verilateCache() + "/" + s_cacheKey;
+    UINFO(2, "   --verilate-cache: entry " << entryDir);
+
+    const std::unique_ptr<std::ifstream> ifp{
+        V3File::new_ifstream_nodepend(entryDir + "/manifest")};
+    if (ifp->fail()) return false;
+    std::vector<std::pair<string, string>> files;  // Cache file, output file
+    V3Os::getline(*ifp);  // Description
+    while (!ifp->eof()) {
+        const string line = V3Os::getline(*ifp);
+        const size_t pos = line.find(' ');
+        if (pos == string::npos) continue;
+        files.emplace_back(entryDir + "/" + line.substr(0, pos),
+                           v3Global.opt.makeDir() + "/" + line.substr(pos + 1));
+    }
+    if (files.empty()) return false;
+    V3File::createMakeDir();
+    for (const auto& pair : files) {
+        // Leave identical outputs alone, so they are not rebuilt
+        if (cacheSameFile(pair.first, pair.second)) continue;
+        if (!cacheCopyFile(pair.first, pair.second)) {
+            UINFO(2, "   --verilate-cache: failed to copy " << pair.first);
+            return false;
+        }
+    }
+    return true;
+}
+
+void V3Incremental::storeCached() {
+    if (!cacheEnabled() || s_cacheKey.empty()) return;
+    const string entryDir = v3Global.opt.verilateCache() + "/" + s_cacheKey;
+    V3Os::createDir(v3Global.opt.verilateCache());
+    V3Os::createDir(entryDir);
+    // Files are written under temporary names then renamed, as other
+    // builds may be reading or writing the same entry
+    const string tmpSuffix = ".tmp" + VHashSha256{V3Os::trueRandom(16)}.digestSymbol();
+    const string outPrefix = v3Global.opt.makeDir() + "/";
+    std::ostringstream manifest;
+    manifest << "# DESCR"
+             << "IPTION: Verilator output: Cached outputs for --verilate-cache\n";
+    int fileNum = 0;
+    for (const string& target : V3File::getAllTargets()) {
+        // Only outputs in the make directory are needed to build the model
+        if (target.compare(0, outPrefix.length(), outPrefix) != 0) continue;
+        // Timestamps would not match on restore
+        if (VString::endsWith(target, "__verFiles.dat")) continue;
+        const string cacheName = "f" + cvtToStr(fileNum++);
+        const string cacheFilename = entryDir + "/" + cacheName;
+        V3Os::filesystemFlush(target);
+        if (!cacheCopyFile(target, cacheFilename + tmpSuffix)
+            || std::rename((cacheFilename + tmpSuffix).c_str(), cacheFilename.c_str()) != 0) {
+            UINFO(2, "   --verilate-cache: failed to store " << target);
+            std::remove((cacheFilename + tmpSuffix).c_str());
+            return;
+        }
+        manifest << cacheName << " " << target.substr(outPrefix.length()) << "\n";
+    }
+    const string manifestFilename = entryDir + "/manifest";
+    {
+        const std::unique_ptr<std::ofstream> ofp{
+            V3File::new_ofstream_nodepend(manifestFilename + tmpSuffix)};
+        if (ofp->fail()) return;
+        *ofp << manifest.str();
+    }
+    std::rename((manifestFilename + tmpSuffix).c_str(), manifestFilename.c_str());
+}
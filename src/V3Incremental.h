@@ -0,0 +1,47 @@
+// -*- mode: C++; c-file-style: "cc-mode" -*-
+//*************************************************************************
+// DESCRIPTION: Verilator: Skip Verilation of unchanged designs
+//
+// Code available from: https://verilator.org
+//
+//*************************************************************************
+//
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of either the GNU Lesser General Public License Version 3
+// or the Perl Artistic License Version 2.0.
+// SPDX-FileCopyrightText: 2003-2026 Wilson Snyder
+// SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+//
+//*************************************************************************
+
+#ifndef VERILATOR_V3INCREMENTAL_H_
+#define VERILATOR_V3INCREMENTAL_H_
+
+#include "config_build.h"
+#include "verilatedos.h"
+
+#include <string>
+
+class AstNetlist;
+
+//============================================================================
+
+class V3Incremental final {
+    static std::string s_digest;  // Hash of the linked netlist of this run
+    static std::string s_cacheKey;  // Hash of the inputs of this run, for --verilate-cache
+
+public:
+    // Hash the linked netlist, and return true if it matches that of the
+    // previous run, and all outputs of that run still exist
+    static bool checkUnchanged(AstNetlist* nodep) VL_MT_DISABLED;
+    // Record the hash and the outputs of this run for the next run
+    static void writeDigest();
+
+    // Hash the command line and all sources read, and if --verilate-cache
+    // has the outputs of a run with the same hash, copy them and return true
+    static bool restoreCached(const std::string& argString);
+    // Copy the outputs of this run into the --verilate-cache
+    static void storeCached();
+};
+
+#endif  // Guard
@@ -28,6 +28,7 @@
 
 #include "V3Inline.h"
 
+#include "V3AstArena.h"
 #include "V3AstUserAllocator.h"
 #include "V3Inst.h"
 #include "V3Stats.h"
@@ -474,6 +475,9 @@ void connectPort(AstNodeModule* modp, AstVar* nodep, AstNodeExpr* pinExprp) {
     UINFO(6, "Connecting " << pinExprp);
     UINFO(6, "        to " << nodep);
 
+    // Once inlined, the value of a shared parameter can be propagated as usual
+    nodep->sharedParam(false);
+
     // Decide whether to inline the port variable or use continuous assignments
     const bool inlineIt = inlinePort(nodep);
 
@@ -696,6 +700,7 @@ void V3Inline::inlineAll(AstNetlist* nodep) {
                         "referencing it was inlined");
         }
     }
+    V3AstArena::compactIfFragmented();
 
     V3Global::dumpCheckGlobalTree("inline", 0, dumpTreeEitherLevel() >= 3);
 }
@@ -24,6 +24,11 @@
 //   --inline-cfuncs <n>         : Always inline if size <= n (default 20)
 //   --inline-cfuncs-product <n> : Also inline if size * call_count <= n (default 200)
 //
+// With function call counts from --prof-pgo-branch profile data, a function
+// called often is allowed more code growth, and a function rarely called is
+// only inlined if that does not grow the code. The decisions are reported in
+// {prefix}__inline_cfuncs.txt.
+//
 //*************************************************************************
 
 #include "V3PchAstNoMT.h"  // VL_MT_DISABLED_CODE_UNIT
@@ -31,13 +36,24 @@
 #include "V3InlineCFuncs.h"
 
 #include "V3AstUserAllocator.h"
+#include "V3Branch.h"
+#include "V3Control.h"
+#include "V3File.h"
 #include "V3Stats.h"
 
+#include <iomanip>
 #include <map>
+#include <memory>
 #include <vector>
 
 VL_DEFINE_DEBUG_FUNCTIONS;
 
+// CONFIG
+// Functions called at most this fraction as often as the most called one are cold
+static constexpr double INLINE_PGO_COLD = 0.001;
+// How many times more code growth than --inline-cfuncs-product the most called function gets
+static constexpr double INLINE_PGO_HOT_GROWTH = 8.0;
+
 //######################################################################
 // Helper visitor to check if a CFunc contains C statements
 // Uses clearOptimizable pattern for debugging
@@ -84,15 +100,22 @@ class InlineCFuncsVisitor final : public VNVisitor {
     // AstCFunc::user1()  ->  vector of AstCCall* pointing to this function
     // AstCFunc::user2()  ->  bool: true if checked for C statements
     // AstCFunc::user3()  ->  bool: true if contains C statements (not inlineable)
+    // AstCFunc::user4()  ->  int: profile decision, 0 = not made, 1 = inline, 2 = don't
     const VNUser1InUse m_user1InUse;
     const VNUser2InUse m_user2InUse;
     const VNUser3InUse m_user3InUse;
+    const VNUser4InUse m_user4InUse;
     AstUser1Allocator<AstCFunc, std::vector<AstCCall*>> m_callSites;
 
     // STATE
     VDouble0 m_statInlined;  // Statistic tracking
+    VDouble0 m_statProfileInline;  // Statistic tracking
+    VDouble0 m_statProfileKeep;  // Statistic tracking
     const int m_threshold1;  // Size threshold: always inline if size <= this
     const int m_threshold2;  // Product threshold: inline if size * calls <= this
+    const bool m_useProfile = V3Control::containsFunctionProfileData();  // Use call counts
+    uint64_t m_maxCalls = 0;  // Most calls of any function in the profile data
+    std::unique_ptr<std::ofstream> m_reportp;  // Profile decision report
     AstCFunc* m_callerFuncp = nullptr;  // Current caller function
     // Tuples of (StmtExpr to replace, CFunc to inline from, caller func for vars)
     std::vector<std::tuple<AstStmtExpr*, AstCFunc*, AstCFunc*>> m_toInline;
@@ -111,6 +134,47 @@ class InlineCFuncsVisitor final : public VNVisitor {
         return cfuncp->user3();
     }
 
+    static bool profileCalls(const AstCFunc* cfuncp, uint64_t& callsr) {
+        const string& name = V3Branch::pgoFunctionName(cfuncp);
+        return !name.empty()
+               && V3Control::getFunctionProfileData(v3Global.opt.prefix(), name, callsr);
+    }
+
+    // Decide from profile data, weighing the calls saved against the code growth
+    bool isProfileInlineable(AstCFunc* cfuncp, size_t funcSize, size_t callCount,
+                             uint64_t calls) {
+        if (!cfuncp->user4()) {
+            // Code added by inlining at every call site
+            const double growth = static_cast<double>(funcSize) * callCount;
+            const double hotness = static_cast<double>(calls) / std::max<uint64_t>(m_maxCalls, 1);
+            bool inlined;
+            double limit;
+            if (hotness <= INLINE_PGO_COLD) {
+                // Keep out of line, unless no bigger than the calls
+                limit = m_threshold1;
+                inlined = growth <= limit;
+            } else {
+                // The more often called, the more growth is worth it
+                limit = m_threshold2 * (1.0 + INLINE_PGO_HOT_GROWTH * hotness);
+                inlined = funcSize <= static_cast<size_t>(m_threshold1) || growth <= limit;
+            }
+            cfuncp->user4(inlined ? 1 : 2);
+            if (inlined) {
+                ++m_statProfileInline;
+            } else {
+                ++m_statProfileKeep;
+            }
+            *m_reportp << std::left << std::setw(8) << (inlined ? "inline" : "keep")
+                       << std::setw(6) << (hotness <= INLINE_PGO_COLD ? "cold" : "hot")
+                       << std::right << std::setw(12) << calls << std::setw(7) << callCount
+                       << std::setw(7) << funcSize << std::setw(9)
+                       << static_cast<uint64_t>(growth) << std::setw(9)
+                       << static_cast<uint64_t>(limit) << "  "
+                       << V3Branch::pgoFunctionName(cfuncp) << "\n";
+        }
+        return cfuncp->user4() == 1;
+    }
+
     // Check if a function is eligible for inlining into caller
     bool isInlineable(const AstCFunc* callerp, AstCFunc* cfuncp) {
         // Must be in the same scope (same class) to access the same members
@@ -133,12 +197,18 @@ class InlineCFuncsVisitor final : public VNVisitor {
 
         // Check size thresholds
         const size_t funcSize = cfuncp->nodeCount();
+        const size_t callCount = m_callSites(cfuncp).size();
+
+        // Profile data replaces the size thresholds
+        uint64_t calls = 0;
+        if (m_useProfile && profileCalls(cfuncp, calls)) {
+            return isProfileInlineable(cfuncp, funcSize, callCount, calls);
+        }
 
         // Always inline if small enough
         if (funcSize <= static_cast<size_t>(m_threshold1)) return true;
 
         // Also inline if size * call_count is reasonable
-        const size_t callCount = m_callSites(cfuncp).size();
         if (callCount > 0 && funcSize * callCount <= static_cast<size_t>(m_threshold2)) {
             return true;
         }
@@ -146,6 +216,29 @@ class InlineCFuncsVisitor final : public VNVisitor {
         return false;
     }
 
+    void openReport(const AstNetlist* nodep) {
+        // Find the most called function, hotness is relative to it
+        for (AstNode* modp = nodep->modulesp(); modp; modp = modp->nextp()) {
+            for (AstNode* stmtp = VN_AS(modp, NodeModule)->stmtsp(); stmtp;
+                 stmtp = stmtp->nextp()) {
+                uint64_t calls = 0;
+                if (const AstCFunc* const funcp = VN_CAST(stmtp, CFunc)) {
+                    if (profileCalls(funcp, calls)) m_maxCalls = std::max(m_maxCalls, calls);
+                }
+            }
+        }
+        const string filename
+            = v3Global.opt.makeDir() + "/" + v3Global.opt.prefix() + "__inline_cfuncs.txt";
+        m_reportp.reset(V3File::new_ofstream(filename));
+        if (m_reportp->fail()) v3fatal("Can't write file: " << filename);
+        *m_reportp << "Verilator CFunc inlining report, from profile data\n";
+        *m_reportp << "Most calls of any function: " << m_maxCalls << "\n\n";
+        *m_reportp << std::left << std::setw(8) << "Action" << std::setw(6) << "Temp" << std::right
+                   << std::setw(12) << "Calls" << std::setw(7) << "Sites" << std::setw(7)
+                   << "Size" << std::setw(9) << "Growth" << std::setw(9) << "Limit"
+                   << "  Function\n";
+    }
+
     // VISITORS
     void visit(AstCCall* nodep) override {
         iterateChildren(nodep);
@@ -250,12 +343,18 @@ public:
         : m_threshold1{v3Global.opt.inlineCFuncs()}
         , m_threshold2{v3Global.opt.inlineCFuncsProduct()} {
         // Don't inline when profiling or tracing
-        if (v3Global.opt.profCFuncs() || v3Global.opt.trace()) return;
+        // With --prof-pgo-branch, so the calls of every function are counted
+        if (v3Global.opt.profCFuncs() || v3Global.opt.profPgoBranch() || v3Global.opt.trace()) {
+            return;
+        }
+        if (m_useProfile) openReport(nodep);
         // Process modules one at a time for better cache behavior
         iterateAndNextNull(nodep->modulesp());
     }
     ~InlineCFuncsVisitor() override {
         V3Stats::addStat("Optimizations, Inlined CFuncs", m_statInlined);
+        V3Stats::addStat("Optimizations, Inlined CFuncs profile inline", m_statProfileInline);
+        V3Stats::addStat("Optimizations, Inlined CFuncs profile keep", m_statProfileKeep);
     }
 };
 
@@ -20,6 +20,12 @@
 //          We also track across if statements:
 //          ASSIGN(X,...) IF( ..., ASSIGN(X,...), ASSIGN(X,...)) => deletes first
 //          We don't do the opposite yet though (remove assigns in if followed by outside if)
+//      Scheduled regions:
+//          Functions called where the caller is not optimized, e.g. the
+//          functions of each scheduled region called from the evaluation
+//          loops, are analysed again on their own, following calls to the
+//          functions they call. Stores overwritten by a later function of
+//          the region with no read in between are then deleted.
 //
 //*************************************************************************
 
@@ -30,6 +36,8 @@
 #include "V3Const.h"
 #include "V3Stats.h"
 
+#include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 VL_DEFINE_DEBUG_FUNCTIONS;
@@ -46,12 +54,36 @@ class LifeState final {
 public:
     VDouble0 m_statAssnDel;  // Statistic tracking
     VDouble0 m_statAssnCon;  // Statistic tracking
+    VDouble0 m_statRegionDel;  // Statistic tracking
+    VDouble0 m_statRegionCon;  // Statistic tracking
+    const bool m_regions;  // Analyse scheduled region functions
+    bool m_inRegion = false;  // Analysing a scheduled region function
+    std::vector<AstCFunc*> m_regionps;  // Scheduled region functions to analyse
+    std::unordered_set<const AstCFunc*> m_regionQueued;  // Already in m_regionps
+    std::unordered_set<const AstCFunc*> m_optimized;  // Entered with optimization enabled
+    std::unordered_map<const AstCFunc*, uint32_t> m_callCount;  // Number of calls to function
 
     // CONSTRUCTORS
-    LifeState() = default;
+    LifeState(AstNetlist* netlistp, bool regions)
+        : m_regions{regions} {
+        if (!m_regions) return;
+        netlistp->foreach([this](const AstNodeCCall* callp) { ++m_callCount[callp->funcp()]; });
+    }
     ~LifeState() {
         V3Stats::addStatSum("Optimizations, Lifetime assign deletions", m_statAssnDel);
         V3Stats::addStatSum("Optimizations, Lifetime constant prop", m_statAssnCon);
+        if (!m_regions) return;
+        V3Stats::addStatSum("Optimizations, Lifetime region assign deletions", m_statRegionDel);
+        V3Stats::addStatSum("Optimizations, Lifetime region constant prop", m_statRegionCon);
+    }
+
+    // METHODS
+    void assignDeleted() { ++(m_inRegion ? m_statRegionDel : m_statAssnDel); }
+    void constPropagated() { ++(m_inRegion ? m_statRegionCon : m_statAssnCon); }
+    void addRegion(AstCFunc* funcp) {
+        // Only functions called once, as the analysis depends on the caller
+        if (!m_regions || m_callCount[funcp] != 1) return;
+        if (m_regionQueued.insert(funcp).second) m_regionps.push_back(funcp);
     }
 };
 
@@ -140,7 +172,7 @@ public:
         UINFOTREE(7, oldassp, "", "REMOVE/SAMEBLK");
         entr.complexAssign();
         oldassp->unlinkFrBack();
-        ++m_statep->m_statAssnDel;
+        m_statep->assignDeleted();
         VL_DO_DANGLING(m_deleter.pushDeletep(oldassp), oldassp);
     }
     void simpleAssign(AstVarScope* nodep, AstNodeAssign* assp) {
@@ -171,14 +203,15 @@ public:
             entr.init(false);
         } else {
             if (AstConst* const constp = entr.constNodep()) {
-                if (!varrefp->varp()->isSigPublic() && !varrefp->varp()->isVirtIface()) {
+                if (!varrefp->varp()->isSigPublic() && !varrefp->varp()->isVirtIface()
+                    && !varrefp->varp()->sharedParam()) {
                     // Aha, variable is constant; substitute in.
                     // We'll later constant propagate
                     UINFO(4, "     replaceconst: " << varrefp);
                     varrefp->replaceWith(constp->cloneTree(false));
                     m_replacedVref = true;
                     VL_DO_DANGLING(varrefp->deleteTree(), varrefp);
-                    ++m_statep->m_statAssnCon;
+                    m_statep->constPropagated();
                     return;  // **DONE, no longer a var reference**
                 }
             }
@@ -362,6 +395,22 @@ class LifeVisitor final : public VNVisitor {
         }
         if (m_containsTiming) setNoopt();
     }
+    void visit(AstExecGraph* nodep) override {
+        // Mtasks may run concurrently, don't optimize across them
+        VL_RESTORER(m_containsTiming);
+        {
+            VL_RESTORER(m_noopt);
+            VL_RESTORER(m_lifep);
+            m_lifep = new LifeBlock{m_lifep, m_statep};
+            setNoopt();
+            iterateChildren(nodep);
+            UINFO(4, "   joinexec");
+            // For the next assignments, clear any variables that were read or written in the block
+            m_lifep->lifeToAbove();
+            VL_DO_DANGLING(delete m_lifep, m_lifep);
+        }
+        if (m_containsTiming) setNoopt();
+    }
     void visit(AstJumpBlock* nodep) override {
         // As with Loop's we can't predict if a JumpGo will kill us or not
         // It's worse though as an IF(..., JUMPGO) may change the control flow.
@@ -388,6 +437,13 @@ class LifeVisitor final : public VNVisitor {
         if (nodep->funcp()->entryPoint()) {
             setNoopt();
         } else {
+            // Not optimized here, e.g. under a loop, so analyse the callee on its own
+            if (m_noopt) m_statep->addRegion(nodep->funcp());
+            // In a region function, a callee with other callers must not be optimized
+            // for this caller only
+            if (m_statep->m_inRegion && m_statep->m_callCount[nodep->funcp()] != 1) {
+                setNoopt();
+            }
             m_tracingCall = true;
             iterate(nodep->funcp());
         }
@@ -397,6 +453,7 @@ class LifeVisitor final : public VNVisitor {
         if (!m_tracingCall && !nodep->entryPoint()) return;
         m_tracingCall = false;
         if (nodep->recursive()) setNoopt();
+        if (!m_noopt) m_statep->m_optimized.insert(nodep);
         if (nodep->dpiImportPrototype() && !nodep->dpiPure()) {
             m_sideEffect = true;  // If appears on assign RHS, don't ever delete the assignment
         }
@@ -426,6 +483,7 @@ public:
     LifeVisitor(AstNode* nodep, LifeState* statep)
         : m_statep{statep} {
         UINFO(4, "  LifeVisitor on " << nodep);
+        m_tracingCall = VN_IS(nodep, CFunc);  // Enter non entry point functions too
         {
             m_lifep = new LifeBlock{nullptr, m_statep};
             iterate(nodep);
@@ -468,6 +526,13 @@ public:
     LifeTopVisitor(AstNetlist* nodep, LifeState* statep)
         : m_statep{statep} {
         iterate(nodep);
+        // Usage model 3: Scheduled region functions not yet optimized, in call order
+        m_statep->m_inRegion = true;
+        for (size_t i = 0; i < m_statep->m_regionps.size(); ++i) {
+            AstCFunc* const funcp = m_statep->m_regionps[i];
+            if (m_statep->m_optimized.count(funcp)) continue;
+            LifeVisitor{funcp, m_statep};
+        }
     }
     ~LifeTopVisitor() override = default;
 };
@@ -478,7 +543,8 @@ public:
 void V3Life::lifeAll(AstNetlist* nodep) {
     UINFO(2, __FUNCTION__ << ":");
     {
-        LifeState state;
+        // Scheduled regions exist once the '_eval' function was created
+        LifeState state{nodep, v3Global.opt.fLifeRegion() && nodep->evalp()};
         LifeTopVisitor{nodep, &state};
     }  // Destruct before checking
     VIsCached::clearCacheTree();  // Removing assignments may affect isPure
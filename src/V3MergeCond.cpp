@@ -70,6 +70,18 @@
 //  function, any merged conditionals will then undergo the same analysis,
 //  optimization, and merging again in their individual branches.
 //
+//  Separately, after V3Branch, small 'if' statements that only assign simple
+//  variables from pure expressions are converted into branchless masked selects
+//  (unless -fno-merge-cond-select):
+//      if (cond) { lhs = thenp; } else { lhs = elsep; }
+//  becomes
+//      lhs = (thenp & -cond) | (elsep & ~-cond);
+//  A branch without an assignment keeps the old value of the LHS. Both sides are
+//  always evaluated, so this is only done when by V3InstrCount the extra work
+//  is cheaper than the expected cost of mispredicting the branch, which is
+//  assumed to be data dependent unless the 'if' has a branch prediction hint,
+//  including hints from branch profile data.
+//
 //*************************************************************************
 
 #include "V3PchAstNoMT.h"  // VL_MT_DISABLED_CODE_UNIT
@@ -79,6 +91,7 @@
 #include "V3AstUserAllocator.h"
 #include "V3DupFinder.h"
 #include "V3Hasher.h"
+#include "V3InstrCount.h"
 #include "V3Stats.h"
 
 #include <queue>
@@ -106,6 +119,21 @@ AstCond* extractCondFromRhs(AstNode* rhsp) {
     return nullptr;
 }
 
+// Skip past AstArraySel and AstWordSel with const index
+AstNode* skipConstSels(AstNode* nodep) {
+    while (const AstArraySel* const aselp = VN_CAST(nodep, ArraySel)) {
+        // ArraySel index is not constant, so might be expensive
+        if (!VN_IS(aselp->bitp(), Const)) return nodep;
+        nodep = aselp->fromp();
+    }
+    while (const AstWordSel* const wselp = VN_CAST(nodep, WordSel)) {
+        // WordSel index is not constant, so might be expensive
+        if (!VN_IS(wselp->bitp(), Const)) return nodep;
+        nodep = wselp->fromp();
+    }
+    return nodep;
+}
+
 // Predicate to check if two sets are disjoint. This is stable, as we only need
 // to determine if the sets contain a shared element, which is a boolean
 // property. It is also efficient as we use sorted sets, and therefore can
@@ -493,21 +521,6 @@ class MergeCondVisitor final : public VNVisitor {
         m_workQueuep = nullptr;
     }
 
-    // Skip past AstArraySel and AstWordSel with const index
-    static AstNode* skipConstSels(AstNode* nodep) {
-        while (const AstArraySel* const aselp = VN_CAST(nodep, ArraySel)) {
-            // ArraySel index is not constant, so might be expensive
-            if (!VN_IS(aselp->bitp(), Const)) return nodep;
-            nodep = aselp->fromp();
-        }
-        while (const AstWordSel* const wselp = VN_CAST(nodep, WordSel)) {
-            // WordSel index is not constant, so might be expensive
-            if (!VN_IS(wselp->bitp(), Const)) return nodep;
-            nodep = wselp->fromp();
-        }
-        return nodep;
-    }
-
     // Check if this node is cheap enough that duplicating it in two branches of an
     // AstIf is not likely to cause a performance degradation.
     static bool isCheapNode(AstNode* nodep) {
@@ -889,6 +902,201 @@ public:
     }
 };
 
+//######################################################################
+// Branchless selects
+
+class MergeCondSelectVisitor final : public VNVisitor {
+    // Expected cost of a mispredicted branch, in instructions. This is roughly
+    // a 15 cycle pipeline flush, at a few instructions per cycle.
+    static constexpr uint32_t MISPREDICT_COST = 40;
+    // Assumed mispredict rate of a branch without a prediction hint, in percent.
+    // Conditions on datapath values are usually data dependent.
+    static constexpr uint32_t MISPREDICT_PERCENT = 50;
+    // Cost of forming the mask from the condition
+    static constexpr uint32_t MASK_COST = 2;
+    // Cost of the masking and combining for one assignment
+    static constexpr uint32_t SELECT_COST = 3;
+    // Maximum number of assignments in a converted 'if'
+    static constexpr size_t MAX_ASSIGNS = 4;
+
+    // TYPES
+    struct AssignPair final {
+        AstAssign* m_thenp;  // Assignment when condition is true, or nullptr
+        AstAssign* m_elsep;  // Assignment when condition is false, or nullptr
+    };
+
+    // STATE
+    VDouble0 m_statSelects;  // Statistic tracking
+    VDouble0 m_statSelectAssigns;  // Statistic tracking
+
+    // METHODS
+
+    // Gather the assignments in a branch, or return false if it has anything else
+    static bool gatherAssigns(AstNode* stmtsp, std::vector<AstAssign*>& assignps) {
+        for (AstNode* nodep = stmtsp; nodep; nodep = nodep->nextp()) {
+            if (VN_IS(nodep, Comment)) continue;
+            AstAssign* const assignp = VN_CAST(nodep, Assign);
+            if (!assignp) return false;
+            if (assignps.size() == MAX_ASSIGNS) return false;
+            assignps.push_back(assignp);
+        }
+        return true;
+    }
+
+    // Check if an assignment is simple enough to be converted to a select
+    static bool isSelectable(const AstAssign* assignp) {
+        AstNodeExpr* const lhsp = assignp->lhsp();
+        if (lhsp->isWide()) return false;
+        if (!lhsp->dtypep()->skipRefp()->isIntegralOrPacked()) return false;
+        if (!VN_IS(skipConstSels(lhsp), VarRef)) return false;
+        AstNodeExpr* const rhsp = assignp->rhsp();
+        if (rhsp->width() != lhsp->width()) return false;
+        return rhsp->isPure();
+    }
+
+    // Pair up the assignments in the two branches of the 'if'. Returns false if not possible.
+    static bool pairAssigns(AstIf* nodep, std::vector<AssignPair>& pairs) {
+        std::vector<AstAssign*> thenps;
+        std::vector<AstAssign*> elseps;
+        if (!gatherAssigns(nodep->thensp(), thenps)) return false;
+        if (!gatherAssigns(nodep->elsesp(), elseps)) return false;
+        if (thenps.empty() && elseps.empty()) return false;
+        if (elseps.empty() || thenps.empty()) {
+            // The old value is read, which might not be initialized in a local
+            for (AstAssign* const assignp : elseps.empty() ? thenps : elseps) {
+                const AstVarRef* const refp = VN_CAST(skipConstSels(assignp->lhsp()), VarRef);
+                if (refp && refp->varp()->isFuncLocal()) return false;
+            }
+        }
+        if (elseps.empty()) {
+            for (AstAssign* const thenp : thenps) pairs.push_back({thenp, nullptr});
+        } else if (thenps.empty()) {
+            for (AstAssign* const elsep : elseps) pairs.push_back({nullptr, elsep});
+        } else {
+            // Both branches must assign the same LHSs, in the same order
+            if (thenps.size() != elseps.size()) return false;
+            for (size_t i = 0; i < thenps.size(); ++i) {
+                if (!thenps[i]->lhsp()->sameTree(elseps[i]->lhsp())) return false;
+                pairs.push_back({thenps[i], elseps[i]});
+            }
+        }
+        for (const AssignPair& pair : pairs) {
+            if (pair.m_thenp && !isSelectable(pair.m_thenp)) return false;
+            if (pair.m_elsep && !isSelectable(pair.m_elsep)) return false;
+        }
+        return true;
+    }
+
+    static uint32_t valueCost(const AstAssign* assignp) {
+        return V3InstrCount::count(assignp->rhsp(), false);
+    }
+
+    // Decide whether the branchless form is cheaper than the expected branch cost
+    static bool isProfitable(AstNodeExpr* condp, const std::vector<AssignPair>& pairs) {
+        // The branch evaluates the condition once, the selects for each of their two masks
+        const uint32_t condCost = V3InstrCount::count(condp, false);
+        uint32_t thenCost = 0;
+        uint32_t elseCost = 0;
+        uint32_t selectCost = MASK_COST + condCost * 2 * pairs.size();
+        for (const AssignPair& pair : pairs) {
+            // Count only the values, the store is the same either way.
+            // A missing side reads the old value of the LHS.
+            const uint32_t tCost = pair.m_thenp ? valueCost(pair.m_thenp) : 1;
+            const uint32_t eCost = pair.m_elsep ? valueCost(pair.m_elsep) : 1;
+            if (pair.m_thenp) thenCost += tCost;
+            if (pair.m_elsep) elseCost += eCost;
+            selectCost += tCost + eCost + SELECT_COST;
+        }
+        const uint32_t branchCost
+            = condCost + std::max(thenCost, elseCost) + MISPREDICT_COST * MISPREDICT_PERCENT / 100;
+        return selectCost <= branchCost;
+    }
+
+    // Value of the LHS, for a branch that does not assign it
+    static AstNodeExpr* oldValue(const AstAssign* assignp) {
+        AstNodeExpr* const valuep = assignp->lhsp()->cloneTreePure(false);
+        valuep->foreach([](AstVarRef* refp) { refp->access(VAccess::READ); });
+        return valuep;
+    }
+
+    // All ones if the condition is true, otherwise zero
+    static AstNodeExpr* newMask(AstNodeExpr* condp, int width) {
+        FileLine* const flp = condp->fileline();
+        AstNodeExpr* valuep = condp->cloneTreePure(false);
+        if (width > 1) valuep = new AstExtend{flp, valuep, width};
+        return new AstNegate{flp, valuep};
+    }
+
+    void convert(AstIf* nodep, const std::vector<AssignPair>& pairs) {
+        UINFO(6, "MergeCond select: " << nodep);
+        ++m_statSelects;
+        AstNodeExpr* const condp = nodep->condp();
+        for (const AssignPair& pair : pairs) {
+            ++m_statSelectAssigns;
+            AstAssign* const assignp = pair.m_thenp ? pair.m_thenp : pair.m_elsep;
+            FileLine* const flp = assignp->fileline();
+            AstNodeExpr* const thenValp
+                = pair.m_thenp ? pair.m_thenp->rhsp()->unlinkFrBack() : oldValue(assignp);
+            AstNodeExpr* const elseValp
+                = pair.m_elsep ? pair.m_elsep->rhsp()->unlinkFrBack() : oldValue(assignp);
+            // lhs = (then & mask) | (else & ~mask). The mask has dirty upper bits, but
+            // the values are clean, so the result is clean.
+            const int width = assignp->lhsp()->width();
+            AstNodeExpr* const selThenp = new AstAnd{flp, newMask(condp, width), thenValp};
+            AstNodeExpr* const selElsep
+                = new AstAnd{flp, new AstNot{flp, newMask(condp, width)}, elseValp};
+            AstAssign* const resultp = new AstAssign{flp, assignp->lhsp()->unlinkFrBack(),
+                                                     new AstOr{flp, selThenp, selElsep}};
+            nodep->addHereThisAsNext(resultp);
+        }
+        VL_DO_DANGLING(pushDeletep(nodep->unlinkFrBack()), nodep);
+    }
+
+    // Check the condition does not read any of the assigned variables, as the
+    // selects are evaluated in sequence
+    static bool condIndependent(const AstIf* nodep, const std::vector<AssignPair>& pairs) {
+        std::set<const AstVar*> lhsVars;
+        for (const AssignPair& pair : pairs) {
+            const AstAssign* const assignp = pair.m_thenp ? pair.m_thenp : pair.m_elsep;
+            assignp->lhsp()->foreach(
+                [&](const AstVarRef* refp) { lhsVars.insert(refp->varp()); });
+        }
+        return !nodep->condp()->exists(
+            [&](const AstVarRef* refp) { return lhsVars.count(refp->varp()) != 0; });
+    }
+
+    // VISITORS
+    void visit(AstIf* nodep) override {
+        // Convert nested 'if' statements first
+        iterateChildren(nodep);
+        // A prediction hint means the branch is predictable, so keep it
+        if (!nodep->branchPred().unknown()) return;
+        AstNodeExpr* const condp = nodep->condp();
+        if (condp->width() != 1 || !condp->isPure()) return;
+        std::vector<AssignPair> pairs;
+        if (!pairAssigns(nodep, pairs)) return;
+        if (!condIndependent(nodep, pairs)) return;
+        if (!isProfitable(condp, pairs)) return;
+        convert(nodep, pairs);
+    }
+
+    void visit(AstCFunc* nodep) override { iterateChildren(nodep); }
+    void visit(AstNodeStmt* nodep) override { iterateChildren(nodep); }
+
+    // For speed, only iterate what is necessary.
+    void visit(AstNetlist* nodep) override { iterateAndNextNull(nodep->modulesp()); }
+    void visit(AstNodeModule* nodep) override { iterateAndNextNull(nodep->stmtsp()); }
+    void visit(AstNode* nodep) override {}
+
+public:
+    // CONSTRUCTORS
+    explicit MergeCondSelectVisitor(AstNetlist* nodep) { iterate(nodep); }
+    ~MergeCondSelectVisitor() override {
+        V3Stats::addStat("Optimizations, MergeCond selects", m_statSelects);
+        V3Stats::addStat("Optimizations, MergeCond select assignments", m_statSelectAssigns);
+    }
+};
+
 }  // namespace
 
 //######################################################################
@@ -899,3 +1107,9 @@ void V3MergeCond::mergeAll(AstNetlist* nodep) {
     { MergeCondVisitor{nodep}; }
     V3Global::dumpCheckGlobalTree("merge_cond", 0, dumpTreeEitherLevel() >= 6);
 }
+
+void V3MergeCond::selectAll(AstNetlist* nodep) {
+    UINFO(2, __FUNCTION__ << ":");
+    { MergeCondSelectVisitor{nodep}; }
+    V3Global::dumpCheckGlobalTree("merge_cond_select", 0, dumpTreeEitherLevel() >= 6);
+}
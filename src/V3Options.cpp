@@ -622,6 +622,7 @@ int V3Options::stripOptionsForChildRun(const string& opt, bool forTop) {
         //
         {"build", 1},
         {"hierarchical", 1},
+        {"hierarchical-auto", 1},
     };
     if (commonOpts.count(opt)) return commonOpts.at(opt);
 
@@ -1072,7 +1073,11 @@ void V3Options::notify() VL_MT_DISABLED {
 
     // Sanity check of expected configuration
     UASSERT(threads() >= 1, "'threads()' must return a value >= 1");
-    if (m_outputGroups == -1) m_outputGroups = (m_buildJobs != -1) ? m_buildJobs : 0;
+    if (m_outputGroups == -1) {
+        // Grouping concatenates files in size order, which would defeat stable splitting
+        m_outputGroups = (m_buildJobs != -1 && !m_outputSplitStable) ? m_buildJobs : 0;
+    }
+    m_buildJobsSet = m_buildJobs != -1;
     if (m_buildJobs == -1) m_buildJobs = 1;
     if (m_verilateJobs == -1) m_verilateJobs = 1;
 
@@ -1479,9 +1484,11 @@ void V3Options::parseOptsList(FileLine* fl, const string& optdir, int argc,
     DECL_OPTION("-finline-funcs-eager", FOnOff, &m_fInlineFuncsEager);
     DECL_OPTION("-flife", FOnOff, &m_fLife);
     DECL_OPTION("-flife-post", FOnOff, &m_fLifePost);
+    DECL_OPTION("-flife-region", FOnOff, &m_fLifeRegion);
     DECL_OPTION("-flocalize", FOnOff, &m_fLocalize);
     DECL_OPTION("-fmerge-cond", FOnOff, &m_fMergeCond);
     DECL_OPTION("-fmerge-cond-motion", FOnOff, &m_fMergeCondMotion);
+    DECL_OPTION("-fmerge-cond-select", FOnOff, &m_fMergeCondSelect);
     DECL_OPTION("-fmerge-const-pool", FOnOff, &m_fMergeConstPool);
     DECL_OPTION("-freloop", FOnOff, &m_fReloop);
     DECL_OPTION("-freorder", FOnOff, &m_fReorder);
@@ -1496,6 +1503,7 @@ void V3Options::parseOptsList(FileLine* fl, const string& optdir, int argc,
     DECL_OPTION("-ftable", FOnOff, &m_fTable);
     DECL_OPTION("-ftaskify-all-forked", FOnOff, &m_fTaskifyAll).undocumented();  // Debug
     DECL_OPTION("-fvar-split", FOnOff, &m_fVarSplit);
+    DECL_OPTION("-fwide-simd", FOnOff, &m_fWideSimd);
     DECL_OPTION("-G", CbPartialMatch, [this](const char* optp) { addParameter(optp, false); });
     DECL_OPTION("-gate-stmts", Set, &m_gateStmts);
     DECL_OPTION("-gdb", CbCall, []() {});  // Processed only in bin/verilator shell
@@ -1514,6 +1522,10 @@ void V3Options::parseOptsList(FileLine* fl, const string& optdir, int argc,
     });
 
     DECL_OPTION("-hierarchical", OnOff, &m_hierarchical);
+    DECL_OPTION("-hierarchical-auto", CbOnOff, [this](bool flag) {
+        m_hierarchicalAuto = flag;
+        if (flag) m_hierarchical = true;
+    });
     DECL_OPTION("-hierarchical-block", CbVal, [this](const char* valp) {
         const V3HierarchicalBlockOption opt{valp};
         m_hierBlocks.emplace(opt.mangledName(), opt);
@@ -1527,6 +1539,7 @@ void V3Options::parseOptsList(FileLine* fl, const string& optdir, int argc,
     }).notForRerun();
     DECL_OPTION("-if-depth", Set, &m_ifDepth);
     DECL_OPTION("-ignc", OnOff, &m_ignc).undocumented();
+    DECL_OPTION("-incremental", OnOff, &m_incremental);
     DECL_OPTION("-inline-cfuncs", Set, &m_inlineCFuncs);
     DECL_OPTION("-inline-cfuncs-product", Set, &m_inlineCFuncsProduct);
     DECL_OPTION("-inline-mult", Set, &m_inlineMult);
@@ -1623,6 +1636,7 @@ void V3Options::parseOptsList(FileLine* fl, const string& optdir, int argc,
             fl->v3error("--output-split-ctrace must be >= 0: " << valp);
         }
     });
+    DECL_OPTION("-output-split-stable", OnOff, &m_outputSplitStable);
 
     DECL_OPTION("-P", Set, &m_preprocNoLine);
     DECL_OPTION("-pins64", CbCall, [this]() { m_pinsBv = 65; });
@@ -1631,6 +1645,7 @@ void V3Options::parseOptsList(FileLine* fl, const string& optdir, int argc,
         m_pinsBv = std::atoi(valp);
         if (m_pinsBv > 65) fl->v3error("--pins-bv maximum is 65: " << valp);
     });
+    DECL_OPTION("-param-share", OnOff, &m_paramShare);
     DECL_OPTION("-pins-inout-enables", OnOff, &m_pinsInoutEnables);
     DECL_OPTION("-pins-sc-uint", CbOnOff, [this](bool flag) {
         m_pinsScUint = flag;
@@ -1660,6 +1675,10 @@ void V3Options::parseOptsList(FileLine* fl, const string& optdir, int argc,
     DECL_OPTION("-prof-cfuncs", CbCall, [this]() { m_profC = m_profCFuncs = true; });
     DECL_OPTION("-prof-exec", OnOff, &m_profExec);
     DECL_OPTION("-prof-pgo", OnOff, &m_profPgo);
+    DECL_OPTION("-prof-pgo-branch", CbOnOff, [this](bool flag) {
+        m_profPgoBranch = flag;
+        if (flag) m_profPgo = true;
+    });
     DECL_OPTION("-profile-cfuncs", CbCall, [this]() {
         m_profC = m_profCFuncs = true;
     }).undocumented();  // Renamed
@@ -1698,6 +1717,7 @@ void V3Options::parseOptsList(FileLine* fl, const string& optdir, int argc,
         m_reloopLimit = std::atoi(valp);
         if (m_reloopLimit < 2) fl->v3error("--reloop-limit must be >= 2: " << valp);
     });
+    DECL_OPTION("-report-parallelism", OnOff, &m_reportParallelism);
     DECL_OPTION("-report-unoptflat", OnOff, &m_reportUnoptflat);
     DECL_OPTION("-rr", CbCall, []() {});  // Processed only in bin/verilator shell
     DECL_OPTION("-runtime-debug", CbCall, [this, fl]() {
@@ -1764,6 +1784,10 @@ void V3Options::parseOptsList(FileLine* fl, const string& optdir, int argc,
                         << fl->warnMore() << "... Suggest 'all', 'none', or 'pure'");
         }
     });
+    DECL_OPTION("-threads-first-touch", OnOff, &m_threadsFirstTouch);
+    DECL_OPTION("-threads-huge-pages", OnOff, &m_threadsHugePages);
+    DECL_OPTION("-threads-pad-shared", OnOff, &m_threadsPadShared);
+    DECL_OPTION("-threads-shared-queue", OnOff, &m_threadsSharedQueue);
     DECL_OPTION("-threads-max-mtasks", CbVal, [this, fl](const char* valp) {
         m_threadsMaxMTasks = std::atoi(valp);
         if (m_threadsMaxMTasks < 1) fl->v3fatal("--threads-max-mtasks must be >= 1: " << valp);
@@ -1839,6 +1863,7 @@ void V3Options::parseOptsList(FileLine* fl, const string& optdir, int argc,
     }).notForRerun();
     DECL_OPTION("-valgrind", CbCall, []() {});  // Processed only in bin/verilator shell
     DECL_OPTION("-verilate", OnOff, &m_verilate);
+    DECL_OPTION("-verilate-cache", Set, &m_verilateCache);
     DECL_OPTION("-verilate-jobs", CbVal, [this, fl](const char* valp) {
         int val = std::atoi(valp);
         if (val < 0) {
@@ -295,6 +295,19 @@ class ParamProcessor final {
     // member names cached for fast lookup
     VMemberMap m_memberMap;
 
+    // Parameters turned into per-instance ports by --param-share
+    std::unordered_map<const AstNodeModule*, std::vector<AstVar*>> m_sharedParams;
+    std::unordered_map<const AstVar*, AstNodeExpr*> m_sharedDefaults;  // Their default values
+    std::unordered_set<std::string> m_xrefNames;  // Names of hierarchically referenced vars
+    bool m_xrefNamesValid = false;  // m_xrefNames has been gathered
+
+    // Statistics
+    VDouble0 m_statSpecialized;  // Number of modules/classes cloned for parameter values
+    VDouble0 m_statReused;  // Number of cells reusing an already cloned module
+    VDouble0 m_statClonedNodes;  // Number of nodes in cloned modules
+    VDouble0 m_statSharedParams;  // Number of parameters made per-instance
+    VDouble0 m_statSharedValues;  // Number of instances passing a per-instance parameter value
+
     // METHODS
 
     static void makeSmallNames(AstNodeModule* modp) {
@@ -800,6 +813,9 @@ class ParamProcessor final {
                 });
         }
 
+        ++m_statSpecialized;
+        if (v3Global.opt.stats()) m_statClonedNodes += newModp->nodeCount();
+
         newModp->name(newname);
         newModp->user2(false);  // We need to re-recurse this module once changed
         newModp->recursive(false);
@@ -912,6 +928,7 @@ class ParamProcessor final {
         auto it = m_modNameMap.find(newname);
         if (it != m_modNameMap.end()) {
             UINFO(4, "     De-parameterize to prev: " << it->second.m_modp);
+            ++m_statReused;
         } else {
             if (!deepCloneModule(srcModp, ifErrorp, paramsp, newname, ifaceRefRefs)) {
                 return nullptr;
@@ -1401,7 +1418,117 @@ class ParamProcessor final {
         return newModp;
     }
 
+    // Check if a parameter declaration could be held per-instance: it must have a
+    // constant default, and a data type with a width not depending on its value
+    static bool isShareableParamDecl(const AstVar* varp) {
+        if (!varp->isGParam() || varp->isIfaceParam()) return false;
+        if (!VN_IS(varp->valuep(), Const)) return false;
+        const AstBasicDType* const dtypep = VN_CAST(varp->childDTypep(), BasicDType);
+        if (!dtypep) return false;
+        const AstRange* const rangep = dtypep->rangep();
+        if (!dtypep->keyword().isIntNumeric() && !(dtypep->implicit() && rangep)) return false;
+        if (rangep && (!VN_IS(rangep->leftp(), Const) || !VN_IS(rangep->rightp(), Const))) {
+            return false;
+        }
+        return true;
+    }
+
+    // Check if a parameter reference is only used as data, in a process or continuous
+    // assignment, and not anywhere a constant is required. Initial and final blocks may
+    // run before or after the port holding the value is set, so these need a constant.
+    static bool isDataParamRef(const AstNode* nodep) {
+        while (true) {
+            // Go to the parent node
+            while (!nodep->firstAbovep()) nodep = nodep->backp();
+            nodep = nodep->firstAbovep();
+            if (VN_IS(nodep, Initial) || VN_IS(nodep, InitialStatic)
+                || VN_IS(nodep, InitialAutomatic) || VN_IS(nodep, Final)) {
+                return false;
+            }
+            if (VN_IS(nodep, NodeProcedure) || VN_IS(nodep, AssignW)) return true;
+            if (VN_IS(nodep, NodeModule) || VN_IS(nodep, NodeDType) || VN_IS(nodep, NodeRange)
+                || VN_IS(nodep, Var) || VN_IS(nodep, Cell) || VN_IS(nodep, Pin)
+                || VN_IS(nodep, NodeFTask) || VN_IS(nodep, NodeGen) || VN_IS(nodep, GenCaseItem)
+                || VN_IS(nodep, Replicate) || VN_IS(nodep, ReplicateN) || VN_IS(nodep, AttrOf)
+                || VN_IS(nodep, Delay) || VN_IS(nodep, SenItem)) {
+                return false;
+            }
+            // Part selects need constant bounds, bit selects do not
+            if (VN_IS(nodep, NodePreSel) && !VN_IS(nodep, SelBit)) return false;
+        }
+    }
+
+    // Turn the parameters of the module that are only used as data into input ports,
+    // so all instances can share the module. Returns the converted parameters.
+    std::vector<AstVar*> makeSharedParams(AstNodeModule* modp) {
+        if (!m_xrefNamesValid) {
+            m_xrefNamesValid = true;
+            v3Global.rootp()->foreach(
+                [&](const AstVarXRef* refp) { m_xrefNames.insert(refp->name()); });
+        }
+        std::vector<AstVar*> candidatesp;
+        int maxPinNum = 0;
+        for (AstNode* stmtp = modp->stmtsp(); stmtp; stmtp = stmtp->nextp()) {
+            AstVar* const varp = VN_CAST(stmtp, Var);
+            if (!varp) continue;
+            maxPinNum = std::max(maxPinNum, varp->pinNum());
+            if (!isShareableParamDecl(varp)) continue;
+            if (m_xrefNames.count(varp->name())) continue;
+            candidatesp.push_back(varp);
+        }
+        std::vector<AstVar*> sharedps;
+        if (candidatesp.empty()) return sharedps;
+        std::unordered_set<const AstVar*> constUsedps;
+        modp->foreach([&](const AstVarRef* refp) {
+            if (!isDataParamRef(refp)) constUsedps.insert(refp->varp());
+        });
+        for (AstVar* const varp : candidatesp) {
+            if (constUsedps.count(varp)) continue;
+            UINFO(4, "Shared parameter: " << varp);
+            ++m_statSharedParams;
+            AstNodeExpr* const valuep = VN_AS(varp->valuep()->unlinkFrBack(), NodeExpr);
+            m_deleter.pushDeletep(valuep);
+            m_sharedDefaults.emplace(varp, valuep);
+            varp->varType(VVarType::VAR);
+            varp->declDirection(VDirection::INPUT);
+            varp->direction(VDirection::INPUT);
+            varp->pinNum(++maxPinNum);
+            varp->sharedParam(true);
+            sharedps.push_back(varp);
+        }
+        return sharedps;
+    }
+
+    // Connect the shared parameters of the instantiated module with port pins, holding
+    // the parameter value from the instance, or the default value
+    void cellShareParams(AstCell* nodep, AstNodeModule* srcModp) {
+        if (!VN_IS(srcModp, Module) || srcModp->hierBlock() || nodep->recursive()) return;
+        auto it = m_sharedParams.find(srcModp);
+        if (it == m_sharedParams.end()) {
+            it = m_sharedParams.emplace(srcModp, makeSharedParams(srcModp)).first;
+        }
+        for (AstVar* const varp : it->second) {
+            AstNodeExpr* valuep = nullptr;
+            for (AstPin* pinp = nodep->paramsp(); pinp; pinp = VN_AS(pinp->nextp(), Pin)) {
+                if (pinp->modVarp() != varp) continue;
+                if (pinp->exprp()) valuep = VN_AS(pinp->exprp()->unlinkFrBack(), NodeExpr);
+                VL_DO_DANGLING(pinp->unlinkFrBack()->deleteTree(), pinp);
+                break;
+            }
+            if (!valuep) valuep = m_sharedDefaults.at(varp)->cloneTree(false);
+            ++m_statSharedValues;
+            // Convert as a parameter assignment would
+            FileLine* const flp = valuep->fileline();
+            AstNodeExpr* const castp = new AstCast{flp, valuep, VFlagChildDType{},
+                                                   varp->childDTypep()->cloneTree(false)};
+            AstPin* const pinp = new AstPin{flp, varp->pinNum(), varp->name(), castp};
+            pinp->modVarp(varp);
+            nodep->addPinsp(pinp);
+        }
+    }
+
     AstNodeModule* cellDeparam(AstCell* nodep, AstNodeModule* srcModp) {
+        if (v3Global.opt.paramShare()) cellShareParams(nodep, srcModp);
         // Must always clone __Vrcm (recursive modules)
         AstNodeModule* const newModp = nodeDeparamCommon(nodep, srcModp, nodep->paramsp(),
                                                          nodep->pinsp(), nodep->recursive());
@@ -1501,7 +1628,15 @@ public:
             m_allModuleNames.insert(modp->name());
         }
     }
-    ~ParamProcessor() = default;
+    ~ParamProcessor() {
+        V3Stats::addStat("Param, Specialized modules", m_statSpecialized);
+        V3Stats::addStat("Param, Specialized module reuses", m_statReused);
+        V3Stats::addStat("Param, Specialized module nodes cloned", m_statClonedNodes);
+        if (v3Global.opt.paramShare()) {
+            V3Stats::addStat("Param, Shared parameters", m_statSharedParams);
+            V3Stats::addStat("Param, Shared parameter values", m_statSharedValues);
+        }
+    }
     VL_UNCOPYABLE(ParamProcessor);
 };
 
@@ -27,6 +27,20 @@
 //
 //   Likewise vector assign to the same constant converted to a loop.
 //
+//   Likewise element-wise operations, where each assignment has the same
+//   expression, with the constant indices of the arrays read shifted by the
+//   same amount as the left hand side index:
+//
+//      ASSIGN(ARRAYREF(a, #), XOR(ARRAYREF(a, #), ARRAYREF(b, #+C)))
+//      ASSIGN(ARRAYREF(a, #+1), XOR(ARRAYREF(a, #+1), ARRAYREF(b, #+1+C)))
+//      ->
+//      FOR(__Vilp = low; __Vilp <= high; ++__Vlip)
+//         ASSIGN(ARRAYREF(a, __Vilp), XOR(ARRAYREF(a, __Vilp), ARRAYREF(b, __Vilp + C)))
+//
+//   The left hand side array may only be read at the element being assigned,
+//   so iterations are independent, and the loop is free of aliasing between
+//   the elements written and read, which lets the C++ compiler vectorize it.
+//
 //*************************************************************************
 
 #include "V3PchAstNoMT.h"  // VL_MT_DISABLED_CODE_UNIT
@@ -47,6 +61,8 @@ class ReloopVisitor final : public VNVisitor {
     // STATE
     VDouble0 m_statReloops;  // Statistic tracking
     VDouble0 m_statReItems;  // Statistic tracking
+    VDouble0 m_statElemwise;  // Statistic tracking
+    VDouble0 m_statElemItems;  // Statistic tracking
     AstCFunc* m_cfuncp = nullptr;  // Current block
 
     std::vector<AstNodeAssign*> m_mgAssignps;  // List of assignments merging
@@ -58,6 +74,8 @@ class ReloopVisitor final : public VNVisitor {
     const AstNodeVarRef* m_mgVarrefRp = nullptr;  // Parent varref, nullptr = constant
     int64_t m_mgOffset = 0;  // Index offset
     const AstConst* m_mgConstRp = nullptr;  // Parent RHS constant, nullptr = sel
+    const AstNodeExpr* m_mgExprRp = nullptr;  // Parent RHS element-wise expression
+    uint32_t m_mgIndexFirst = 0;  // Left index of first assignment, for element-wise
     uint32_t m_mgIndexLo = 0;  // Merge range
     uint32_t m_mgIndexHi = 0;  // Merge range
 
@@ -70,12 +88,62 @@ class ReloopVisitor final : public VNVisitor {
             = new AstVar{fl, VVarType::STMTTEMP, newvarname, VFlagLogicPacked{}, 32};
         return varp;
     }
+    // Select of a constant element of an array variable, the indices element-wise
+    // expressions shift
+    static bool isConstElement(const AstNode* nodep) {
+        if (!VN_IS(nodep, ArraySel) && !VN_IS(nodep, WordSel)) return false;
+        const AstNodeSel* const selp = VN_AS(nodep, NodeSel);
+        const AstConst* const bitp = VN_CAST(selp->bitp(), Const);
+        return bitp && bitp->width() <= 32 && VN_IS(selp->fromp(), NodeVarRef);
+    }
+    static uint32_t elementIndex(const AstNode* nodep) {
+        return VN_AS(VN_AS(nodep, NodeSel)->bitp(), Const)->toUInt();
+    }
+    // Return true if the two trees are identical, except the constant element
+    // indices in 'nodep' are those of 'basep' plus 'delta'
+    static bool isShiftedExpr(const AstNode* basep, const AstNode* nodep, int64_t delta) {
+        if (!basep && !nodep) return true;
+        if (!basep || !nodep) return false;
+        if (!basep->isSame(nodep)) return false;
+        if (!basep->dtypep() != !nodep->dtypep()) return false;
+        if (basep->dtypep() && !basep->dtypep()->similarDType(nodep->dtypep())) return false;
+        if (isConstElement(basep)) {
+            if (!isConstElement(nodep)) return false;
+            if (!VN_AS(basep, NodeSel)->fromp()->isSame(VN_AS(nodep, NodeSel)->fromp())) {
+                return false;
+            }
+            if (static_cast<int64_t>(elementIndex(nodep))
+                != static_cast<int64_t>(elementIndex(basep)) + delta) {
+                return false;
+            }
+        } else if (!isShiftedExpr(basep->op1p(), nodep->op1p(), delta)
+                   || !isShiftedExpr(basep->op2p(), nodep->op2p(), delta)
+                   || !isShiftedExpr(basep->op3p(), nodep->op3p(), delta)
+                   || !isShiftedExpr(basep->op4p(), nodep->op4p(), delta)) {
+            return false;
+        }
+        return isShiftedExpr(basep->nextp(), nodep->nextp(), delta);
+    }
+    // Return true if the expression only reads the left hand side variable at
+    // the element being assigned, so iterations are independent
+    static bool isElementwiseSafe(const AstNodeExpr* rhsp, const AstVar* lvarp,
+                                  uint32_t lindex) {
+        return rhsp->forall([&](const AstNodeVarRef* refp) {
+            if (refp->varp() != lvarp) return true;
+            const AstNode* const selp = refp->backp();
+            return isConstElement(selp) && VN_AS(selp, NodeSel)->fromp() == refp
+                   && elementIndex(selp) == lindex;
+        });
+    }
+
     void mergeEnd() {
         if (!m_mgAssignps.empty()) {
             const uint32_t items = m_mgIndexHi - m_mgIndexLo + 1;
             UINFO(9, "End merge iter=" << items << " " << m_mgIndexHi << ":" << m_mgIndexLo << " "
                                        << m_mgOffset << " " << m_mgAssignps[0]);
-            if (items >= static_cast<uint32_t>(v3Global.opt.reloopLimit())) {
+            if (m_mgExprRp && items >= static_cast<uint32_t>(v3Global.opt.reloopLimit())) {
+                mergeEndElementwise(items);
+            } else if (items >= static_cast<uint32_t>(v3Global.opt.reloopLimit())) {
                 UINFO(6, "Reloop merging items=" << items << " " << m_mgIndexHi << ":"
                                                  << m_mgIndexLo << " " << m_mgOffset << " "
                                                  << m_mgAssignps[0]);
@@ -141,6 +209,63 @@ class ReloopVisitor final : public VNVisitor {
             m_mgVarrefRp = nullptr;
             m_mgOffset = 0;
             m_mgConstRp = nullptr;
+            m_mgExprRp = nullptr;
+        }
+    }
+    void mergeEndElementwise(uint32_t items) {
+        UINFO(6, "Reloop element-wise items=" << items << " " << m_mgIndexHi << ":"
+                                              << m_mgIndexLo << " " << m_mgAssignps[0]);
+        ++m_statElemwise;
+        m_statElemItems += items;
+
+        // Transform first assign into for loop body
+        AstNodeAssign* const bodyp = m_mgAssignps.front();
+        UASSERT_OBJ(bodyp->lhsp() == m_mgSelLp && bodyp->rhsp() == m_mgExprRp, bodyp,
+                    "Corrupt queue/state");
+        FileLine* const fl = bodyp->fileline();
+        AstVar* const itp = createVarTemp(fl, m_mgCfuncp);
+
+        AstNode* const initp = new AstAssign{fl, new AstVarRef{fl, itp, VAccess::WRITE},
+                                             new AstConst{fl, m_mgIndexLo}};
+        AstNodeExpr* const condp = new AstLte{fl, new AstVarRef{fl, itp, VAccess::READ},
+                                              new AstConst{fl, m_mgIndexHi}};
+        AstNode* const incp = new AstAssign{
+            fl, new AstVarRef{fl, itp, VAccess::WRITE},
+            new AstAdd{fl, new AstConst{fl, 1}, new AstVarRef{fl, itp, VAccess::READ}}};
+        AstLoop* const loopp = new AstLoop{fl};
+        loopp->addStmtsp(new AstLoopTest{fl, loopp, condp});
+        initp->addNext(loopp);
+        itp->AstNode::addNext(initp);
+        bodyp->replaceWith(itp);
+        loopp->addStmtsp(bodyp);
+        loopp->addStmtsp(incp);
+
+        // Replace constant indices with the loop index, plus their offset from
+        // the index assigned by the first assignment
+        std::vector<AstNodeSel*> selps;
+        selps.push_back(VN_AS(bodyp->lhsp(), NodeSel));
+        bodyp->rhsp()->foreach([&](AstNodeSel* selp) {
+            if (isConstElement(selp)) selps.push_back(selp);
+        });
+        for (AstNodeSel* const selp : selps) {
+            AstNodeExpr* const bitp = selp->bitp();
+            const int64_t offset = static_cast<int64_t>(elementIndex(selp))
+                                   - static_cast<int64_t>(m_mgIndexFirst);
+            AstNodeExpr* newp = new AstVarRef{fl, itp, VAccess::READ};
+            if (offset > 0) {
+                newp = new AstAdd{fl, newp, new AstConst{fl, static_cast<uint32_t>(offset)}};
+            } else if (offset < 0) {
+                newp = new AstSub{fl, newp, new AstConst{fl, static_cast<uint32_t>(-offset)}};
+            }
+            bitp->replaceWith(newp);
+            VL_DO_DANGLING(bitp->deleteTree(), bitp);
+        }
+        UINFOTREE(9, initp, "", "new");
+        UINFOTREE(9, loopp, "", "new");
+
+        // Remove remaining assigns
+        for (AstNodeAssign* assp : m_mgAssignps) {
+            if (assp != bodyp) VL_DO_DANGLING(assp->unlinkFrBack()->deleteTree(), assp);
         }
     }
 
@@ -178,13 +303,20 @@ class ReloopVisitor final : public VNVisitor {
             return;
         }
 
-        // RHS is a constant or a select
+        // RHS is a constant, a select or an element-wise expression
         const AstConst* const rconstp = VN_CAST(nodep->rhsp(), Const);
         const AstNodeSel* const rselp = VN_CAST(nodep->rhsp(), NodeSel);
         const AstNodeVarRef* rvarrefp = nullptr;
+        const AstNodeExpr* rexprp = nullptr;
         uint32_t rindex = lindex;
         if (rconstp) {  // Ok
-        } else if (rselp) {
+        } else if (!rselp) {  // Element-wise expression
+            if (!isConstElement(lselp) || !nodep->rhsp()->isPure()) {
+                mergeEnd();
+                return;
+            }
+            rexprp = nodep->rhsp();
+        } else {
             const AstConst* const rbitp = VN_CAST(rselp->bitp(), Const);
             rvarrefp = VN_CAST(rselp->fromp(), NodeVarRef);
             if (!rbitp || !rvarrefp || lvarrefp->varp() == rvarrefp->varp()) {
@@ -192,20 +324,22 @@ class ReloopVisitor final : public VNVisitor {
                 return;
             }
             rindex = rbitp->toUInt();
-        } else {
-            mergeEnd();
-            return;
         }
 
         if (m_mgSelLp) {  // Old merge
+            const int64_t delta
+                = static_cast<int64_t>(lindex) - static_cast<int64_t>(m_mgIndexFirst);
             if (m_mgCfuncp == m_cfuncp  // In same function
                 && m_mgNextp == nodep  // Consecutive node
                 && m_mgVarrefLp->isSame(lvarrefp)  // Same array on left hand side
                 && (m_mgConstRp  // On the right hand side either ...
                         ? (rconstp && m_mgConstRp->isSame(rconstp))  // ... same constant
+                    : m_mgExprRp  // ... or same shifted expression
+                        ? (rexprp && isShiftedExpr(m_mgExprRp, rexprp, delta))
                         : (rselp && m_mgVarrefRp->isSame(rvarrefp)))  // ... or same array
                 && (lindex == m_mgIndexLo - 1 || lindex == m_mgIndexHi + 1)  // Left index +/- 1
-                && (m_mgConstRp || lindex == rindex + m_mgOffset)  // Same right index offset
+                && (m_mgConstRp || m_mgExprRp
+                    || lindex == rindex + m_mgOffset)  // Same right index offset
             ) {
                 // Sequentially next to last assign; continue merge
                 if (lindex == m_mgIndexLo - 1) {
@@ -227,6 +361,9 @@ class ReloopVisitor final : public VNVisitor {
             }
         }
 
+        // Element-wise expressions must not read other elements being assigned
+        if (rexprp && !isElementwiseSafe(rexprp, lvarrefp->varp(), lindex)) return;
+
         // Merge start
         m_mgAssignps.push_back(nodep);
         m_mgCfuncp = m_cfuncp;
@@ -237,6 +374,8 @@ class ReloopVisitor final : public VNVisitor {
         m_mgVarrefRp = rvarrefp;
         m_mgOffset = static_cast<int64_t>(lindex) - static_cast<int64_t>(rindex);
         m_mgConstRp = rconstp;
+        m_mgExprRp = rexprp;
+        m_mgIndexFirst = lindex;
         m_mgIndexLo = lindex;
         m_mgIndexHi = lindex;
         UINFO(9, "Start merge i=" << lindex << " o=" << m_mgOffset << nodep);
@@ -253,6 +392,8 @@ public:
     ~ReloopVisitor() override {
         V3Stats::addStat("Optimizations, Reloops", m_statReloops);
         V3Stats::addStat("Optimizations, Reloop iterations", m_statReItems);
+        V3Stats::addStat("Optimizations, Reloop element-wise", m_statElemwise);
+        V3Stats::addStat("Optimizations, Reloop element-wise iterations", m_statElemItems);
     }
 };
 
@@ -173,4 +173,9 @@ void V3Stats::statsStageAll(AstNetlist* nodep, const std::string& stage, bool fa
     StatsVisitor{nodep, stage, fastOnly};
 }
 
-void V3Stats::statsFinalAll(AstNetlist* nodep) { statsStageAll(nodep, "Final"); }
+void V3Stats::statsFinalAll(AstNetlist* nodep) {
+    statsStageAll(nodep, "Final");
+    const double uniqueMiB = VInternStr::statUniqueBytes() / 1024.0 / 1024.0;
+    addStat("String interning, Unique names", VInternStr::statUnique());
+    addStat("String interning, Unique names (MiB)", uniqueMiB, 3);
+}
@@ -16,6 +16,7 @@
 
 #include "V3PchAstMT.h"
 
+#include "V3AstArena.h"
 #include "V3File.h"
 #include "V3Global.h"
 #include "V3Os.h"
@@ -219,6 +220,10 @@ void V3Stats::statsStage(const string& name) {
     VlOs::memUsageBytes(memPeak /*ref*/, memCurrent /*ref*/);
     V3Stats::addStatPerf("Stage, Memory current (MB), " + digitName, memCurrent / 1024.0 / 1024.0);
     V3Stats::addStatPerf("Stage, Memory peak (MB), " + digitName, memPeak / 1024.0 / 1024.0);
+    V3Stats::addStatPerf("Stage, AST arena in use (MB), " + digitName,
+                         V3AstArena::bytesInUse() / 1024.0 / 1024.0);
+    V3Stats::addStatPerf("Stage, AST arena reserved (MB), " + digitName,
+                         V3AstArena::bytesReserved() / 1024.0 / 1024.0);
 }
 
 void V3Stats::infoHeader(std::ofstream& os, const string& prefix) {
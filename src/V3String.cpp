@@ -32,11 +32,55 @@ VL_DEFINE_DEBUG_FUNCTIONS;
 
 #include <algorithm>
 #include <fcntl.h>
+#include <unordered_set>
 
 size_t VName::s_minLength = 32;
 size_t VName::s_maxLength = 0;  // Disabled
 std::map<string, string> VName::s_dehashMap;
 
+//######################################################################
+// VInternStr
+
+class VInternStrTable final {
+public:
+    // MEMBERS
+    V3Mutex m_mutex;  // Protects below
+    std::unordered_set<std::string> m_strs VL_GUARDED_BY(m_mutex);  // Interned strings
+    size_t m_uniqueBytes VL_GUARDED_BY(m_mutex) = 0;  // Bytes in m_strs
+
+    static VInternStrTable& s() VL_MT_SAFE {
+        // Never destructed, as strings may be referenced during static destruction
+        static VInternStrTable* const s_tablep = new VInternStrTable;
+        return *s_tablep;
+    }
+};
+
+const std::string* VInternStr::intern(const std::string& str) VL_MT_SAFE {
+    VInternStrTable& table = VInternStrTable::s();
+    const V3LockGuard lock{table.m_mutex};
+    const auto it = table.m_strs.find(str);
+    if (it != table.m_strs.end()) return &*it;
+    table.m_uniqueBytes += str.size() + 1;
+    return &*table.m_strs.emplace(str).first;
+}
+
+const std::string* VInternStr::emptyp() VL_MT_SAFE {
+    static const std::string* const s_emptyp = intern("");
+    return s_emptyp;
+}
+
+size_t VInternStr::statUnique() VL_MT_SAFE {
+    VInternStrTable& table = VInternStrTable::s();
+    const V3LockGuard lock{table.m_mutex};
+    return table.m_strs.size();
+}
+
+size_t VInternStr::statUniqueBytes() VL_MT_SAFE {
+    VInternStrTable& table = VInternStrTable::s();
+    const V3LockGuard lock{table.m_mutex};
+    return table.m_uniqueBytes;
+}
+
 //######################################################################
 // Wildcard
 
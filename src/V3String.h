@@ -226,6 +226,73 @@ public:
     static string dehash(const string& in);
 };
 
+//######################################################################
+// VInternStr - Immutable string interned in a global table, so equal
+// strings share a single copy, and compare equal by pointer.
+// Used for AST names, which after flattening repeat very many times.
+
+class VInternStr final {
+    const std::string* m_strp;  // Interned string, never freed
+
+    static const std::string* intern(const std::string& str) VL_MT_SAFE;
+    static const std::string* emptyp() VL_MT_SAFE;
+
+public:
+    // CONSTRUCTORS
+    VInternStr()
+        : m_strp{emptyp()} {}
+    // cppcheck-suppress noExplicitConstructor
+    VInternStr(const std::string& str)
+        : m_strp{intern(str)} {}
+    // cppcheck-suppress noExplicitConstructor
+    VInternStr(const char* strp)
+        : m_strp{intern(strp)} {}
+    // METHODS
+    const std::string& str() const VL_MT_SAFE { return *m_strp; }
+    operator const std::string&() const VL_MT_SAFE { return *m_strp; }
+    const char* c_str() const { return m_strp->c_str(); }
+    bool empty() const { return m_strp->empty(); }
+    size_t size() const { return m_strp->size(); }
+    size_t length() const { return m_strp->length(); }
+    // Interned, so equal strings are the same object
+    bool operator==(const VInternStr& rhs) const { return m_strp == rhs.m_strp; }
+    bool operator!=(const VInternStr& rhs) const { return m_strp != rhs.m_strp; }
+    bool operator<(const VInternStr& rhs) const {
+        return m_strp != rhs.m_strp && *m_strp < *rhs.m_strp;
+    }
+    // Ordering usable for lookup by VInternStr or std::string
+    struct Less final {
+        using is_transparent = void;
+        bool operator()(const VInternStr& lhs, const VInternStr& rhs) const { return lhs < rhs; }
+        bool operator()(const VInternStr& lhs, const std::string& rhs) const {
+            return lhs.str() < rhs;
+        }
+        bool operator()(const std::string& lhs, const VInternStr& rhs) const {
+            return lhs < rhs.str();
+        }
+    };
+    // STATISTICS
+    static size_t statUnique() VL_MT_SAFE;  // Number of distinct strings
+    static size_t statUniqueBytes() VL_MT_SAFE;  // Bytes in distinct strings
+};
+inline bool operator==(const VInternStr& lhs, const std::string& rhs) { return lhs.str() == rhs; }
+inline bool operator==(const std::string& lhs, const VInternStr& rhs) { return lhs == rhs.str(); }
+inline bool operator==(const VInternStr& lhs, const char* rhs) { return lhs.str() == rhs; }
+inline bool operator!=(const VInternStr& lhs, const std::string& rhs) { return lhs.str() != rhs; }
+inline bool operator!=(const std::string& lhs, const VInternStr& rhs) { return lhs != rhs.str(); }
+inline bool operator!=(const VInternStr& lhs, const char* rhs) { return lhs.str() != rhs; }
+inline std::string operator+(const VInternStr& lhs, const std::string& rhs) {
+    return lhs.str() + rhs;
+}
+inline std::string operator+(const std::string& lhs, const VInternStr& rhs) {
+    return lhs + rhs.str();
+}
+inline std::string operator+(const VInternStr& lhs, const char* rhs) { return lhs.str() + rhs; }
+inline std::string operator+(const char* lhs, const VInternStr& rhs) { return lhs + rhs.str(); }
+inline std::ostream& operator<<(std::ostream& os, const VInternStr& rhs) {
+    return os << rhs.str();
+}
+
 //######################################################################
 // VSpellCheck - Find near-match spelling suggestions given list of possibilities
 
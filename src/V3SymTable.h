@@ -43,7 +43,8 @@ using VSymConstMap = std::unordered_set<const VSymEnt*>;
 class VSymEnt final {
     // Symbol table that can have a "superior" table for resolving upper references
     // MEMBERS
-    using IdNameMap = std::multimap<std::string, VSymEnt*>;
+    // Keys interned so shared with the AST names; lookup by std::string needs no interning
+    using IdNameMap = std::multimap<VInternStr, VSymEnt*, VInternStr::Less>;
     IdNameMap m_idNameMap;  // Hash of variables by name
     AstNode* m_nodep;  // Node that entry belongs to
     VSymEnt* m_fallbackp = nullptr;  // Table "above" this in name scope, for fallback resolution
@@ -18,6 +18,9 @@
 //      Count # of input bits and # of output bits, and # of statements
 //      If high # of statements relative to inpbits*outbits,
 //      replace with lookup table
+//      If the flat table is too large, simulate all inputs anyway, and see if
+//      it compresses into a first level table indexed by the upper input bits,
+//      selecting one of the distinct sub-tables indexed by the lower input bits
 //
 //*************************************************************************
 
@@ -28,7 +31,9 @@
 #include "V3Simulate.h"
 #include "V3Stats.h"
 
+#include <algorithm>
 #include <cmath>
+#include <map>
 #include <vector>
 
 VL_DEFINE_DEBUG_FUNCTIONS;
@@ -47,6 +52,12 @@ static constexpr int TABLE_SPACE_TIME_MULT = 8;
 static constexpr int TABLE_MIN_NODE_COUNT = 32;
 // Assume an instruction is 4 bytes
 static constexpr int TABLE_BYTES_PER_INST = 4;
+// Largest input width to try splitting into two levels (1M simulations)
+static constexpr unsigned TABLE_SPLIT_MAX_INPUT_BITS = 20;
+// Bound simulation effort (input values * instructions) when trying to split
+static constexpr double TABLE_SPLIT_MAX_SIM_INSTRS = 64.0 * 1024 * 1024;
+// Bound memory (input values * (outputs + 1) * 8 bytes) when trying to split
+static constexpr double TABLE_SPLIT_MAX_VALUES = 4.0 * 1024 * 1024;
 
 //######################################################################
 
@@ -152,6 +163,7 @@ class TableVisitor final : public VNVisitor {
     // STATE
     double m_totalBytes = 0;  // Total bytes in tables created
     VDouble0 m_statTablesCre;  // Statistic tracking
+    VDouble0 m_statTablesSplit;  // Statistic tracking
 
     //  State cleared on each module
     AstNodeModule* m_modp = nullptr;  // Current MODULE
@@ -162,6 +174,8 @@ class TableVisitor final : public VNVisitor {
 
     //  State cleared on each always/assignw
     bool m_assignDly = false;  // Consists of delayed assignments instead of normal assignments
+    bool m_split = false;  // Flat table too large, try a two level table
+    double m_time = 0;  // Instruction count bytes of the original logic
     unsigned m_inWidthBits = 0;  // Input table width - in bits
     unsigned m_outWidthBytes = 0;  // Output table width - in bytes
     std::vector<AstVarScope*> m_inVarps;  // Input variable list
@@ -187,8 +201,23 @@ public:
     }
 
 private:
+    bool splitCandidate(int instrCount) const {
+        // Whether simulating every input value to attempt a two level table is affordable
+        if (m_inWidthBits < 2 || m_inWidthBits > TABLE_SPLIT_MAX_INPUT_BITS) return false;
+        if (m_outVarps.size() > 64) return false;  // Output assigned mask must fit a uint64_t
+        const double entries = std::pow<double>(2.0, m_inWidthBits);
+        if (entries * instrCount > TABLE_SPLIT_MAX_SIM_INSTRS) return false;
+        if (entries * (m_outVarps.size() + 1) > TABLE_SPLIT_MAX_VALUES) return false;
+        for (const TableOutputVar& tov : m_outVarps) {
+            const AstNodeDType* const dtypep = tov.varScopep()->dtypep()->skipRefp();
+            if (dtypep->isString() || dtypep->isDouble() || dtypep->width() > 64) return false;
+        }
+        return true;
+    }
+
     bool treeTest(AstAlways* nodep) {
         // Process alw/assign tree
+        m_split = false;
         m_inWidthBits = 0;
         m_outWidthBytes = 0;
         m_inVarps.clear();
@@ -220,12 +249,19 @@ private:
         if (chkvis.instrCount() < TABLE_MIN_NODE_COUNT) {
             chkvis.clearOptimizable(nodep, "Table has too few nodes involved");
         }
-        // cppcheck-suppress knownConditionTrueFalse
-        if (space > TABLE_MAX_BYTES) {
-            chkvis.clearOptimizable(nodep, "Table takes too much space");
-        }
-        if (space > time * TABLE_SPACE_TIME_MULT) {
-            chkvis.clearOptimizable(nodep, "Table has bad tradeoff");
+        m_time = time;
+        if ((space > TABLE_MAX_BYTES || space > time * TABLE_SPACE_TIME_MULT)
+            && chkvis.optimizable() && splitCandidate(chkvis.instrCount())) {
+            // Decided in replaceWithSplitTable, once the compressed size is known
+            m_split = true;
+        } else {
+            // cppcheck-suppress knownConditionTrueFalse
+            if (space > TABLE_MAX_BYTES) {
+                chkvis.clearOptimizable(nodep, "Table takes too much space");
+            }
+            if (space > time * TABLE_SPACE_TIME_MULT) {
+                chkvis.clearOptimizable(nodep, "Table has bad tradeoff");
+            }
         }
         if (m_totalBytes > TABLE_TOTAL_BYTES) {
             chkvis.clearOptimizable(nodep, "Table out of memory");
@@ -234,8 +270,9 @@ private:
                                 << chkvis.instrCount() << " Data=" << chkvis.dataCount()
                                 << " in width (bits)=" << m_inWidthBits << " out width (bytes)="
                                 << m_outWidthBytes << " Spacetime=" << (space / time) << "("
-                                << space << "/" << time << ")" << ": " << nodep);
-        if (chkvis.optimizable()) {
+                                << space << "/" << time << ")" << (m_split ? " Split" : "")
+                                << ": " << nodep);
+        if (chkvis.optimizable() && !m_split) {
             UINFO(3, " Table Optimize spacetime=" << (space / time) << " " << nodep);
             m_totalBytes += space;
         }
@@ -250,12 +287,8 @@ private:
         FileLine* const fl = nodep->fileline();
 
         // We will need a table index variable, create it here.
-        AstVar* const indexVarp
-            = new AstVar{fl, VVarType::BLOCKTEMP, "__Vtableidx" + cvtToStr(m_modTables),
-                         VFlagBitPacked{}, static_cast<int>(m_inWidthBits)};
-        m_modp->addStmtsp(indexVarp);
-        AstVarScope* const indexVscp = new AstVarScope{indexVarp->fileline(), m_scopep, indexVarp};
-        m_scopep->addVarsp(indexVscp);
+        AstVarScope* const indexVscp
+            = createIndexVar(fl, "__Vtableidx" + cvtToStr(m_modTables), m_inWidthBits);
 
         // The 'output assigned' table builder
         TableBuilder outputAssignedTableBuilder{fl};
@@ -279,6 +312,210 @@ private:
         UINFOTREE(6, nodep, "", "table_new");
     }
 
+    void replaceWithSplitTable(AstAlways* nodep) {
+        // The flat table was too large, or not worth it. Simulate every input value, then
+        // number the distinct blocks of outputs for each value of the low input bits. If few
+        // blocks are distinct, a first level table indexed by the high input bits selects
+        // the block, and the output tables hold only the distinct blocks.
+        const uint32_t entries = 1U << m_inWidthBits;
+        const double entryBytes = m_outWidthBytes + m_outVarps.size();
+        const double maxSpace = std::min({static_cast<double>(TABLE_MAX_BYTES),
+                                          m_time * TABLE_SPACE_TIME_MULT,
+                                          TABLE_TOTAL_BYTES - m_totalBytes});
+
+        // Number the distinct rows of {assigned mask, output values}, so blocks compare cheaply
+        std::vector<uint32_t> rowIds(entries);
+        std::vector<std::vector<uint64_t>> rowValues;  // Row number -> row
+        {
+            std::map<std::vector<uint64_t>, uint32_t> rows;
+            std::vector<uint64_t> row(m_outVarps.size() + 1);
+            TableSimulateVisitor simvis{this};
+            for (uint32_t inValue = 0; inValue < entries; ++inValue) {
+                simulateInput(simvis, nodep, inValue);
+                std::fill(row.begin(), row.end(), 0);
+                for (TableOutputVar& tov : m_outVarps) {
+                    if (V3Number* const outnump = simvis.fetchOutNumberNull(tov.varScopep())) {
+                        UASSERT_OBJ(!outnump->isAnyXZ(), outnump, "Table should not contain X/Z");
+                        row[0] |= 1ULL << tov.ord();
+                        row[tov.ord() + 1] = outnump->toUQuad();
+                    } else {
+                        tov.setMayBeUnassigned();
+                    }
+                }
+                const uint32_t nextId = static_cast<uint32_t>(rowValues.size());
+                const auto pair = rows.emplace(row, nextId);
+                if (pair.second) {
+                    rowValues.push_back(row);
+                    // Every distinct row is stored at least once, whatever the split
+                    if (rowValues.size() * entryBytes > maxSpace) {
+                        UINFO(4, "  Split table not worthwhile, too many distinct rows: "
+                                     << nodep);
+                        return;
+                    }
+                }
+                rowIds[inValue] = pair.first->second;
+            }
+        }
+
+        // Pick the split with the smallest total size, giving up on a width as soon as
+        // it has more distinct blocks than would beat the best so far
+        std::vector<uint32_t> blockIds;  // Block number -> distinct block number
+        std::vector<uint32_t> blockFirsts;  // Distinct block number -> first input value
+        unsigned loBits = 0;
+        double space = maxSpace;
+        for (unsigned bits = 1; bits < m_inWidthBits; ++bits) {
+            const double blockBytes = static_cast<double>(1U << bits) * entryBytes;
+            const double maxBlocks = (space - (entries >> bits)) / blockBytes;
+            if (maxBlocks < 1) continue;
+            const uint32_t nBlocks = numberBlocks(rowIds, bits, maxBlocks, blockIds, blockFirsts);
+            if (!nBlocks) continue;
+            const unsigned idBits = blockIdBits(nBlocks);
+            const double idBytes = idBits <= 8 ? 1 : idBits <= 16 ? 2 : 4;
+            const double bitsSpace
+                = nBlocks * blockBytes + static_cast<double>(entries >> bits) * idBytes;
+            if (loBits ? bitsSpace < space : bitsSpace <= space) {
+                loBits = bits;
+                space = bitsSpace;
+            }
+        }
+        if (!loBits) {
+            UINFO(4, "  Split table not worthwhile: " << nodep);
+            return;
+        }
+        UINFO(4, "  Split: low bits=" << loBits << " Spacetime=" << (space / m_time) << "("
+                                      << space << "/" << m_time << ")" << ": " << nodep);
+        UINFO(3, " Table Optimize split spacetime=" << (space / m_time) << " " << nodep);
+        m_totalBytes += space;
+        ++m_modTables;
+        ++m_statTablesCre;
+        ++m_statTablesSplit;
+
+        const uint32_t nBlocks
+            = numberBlocks(rowIds, loBits, rowIds.size(), blockIds, blockFirsts);
+        const unsigned idBits = blockIdBits(nBlocks);
+        const unsigned hiBits = m_inWidthBits - loBits;
+        FileLine* const fl = nodep->fileline();
+        AstVarScope* const indexVscp
+            = createIndexVar(fl, "__Vtableidx" + cvtToStr(m_modTables), m_inWidthBits);
+        AstVarScope* const subIndexVscp
+            = createIndexVar(fl, "__Vtablesubidx" + cvtToStr(m_modTables), idBits + loBits);
+
+        // First level table, high input bits to distinct block number
+        TableBuilder blockTableBuilder{fl};
+        blockTableBuilder.setTableSize(nodep->findBitDType(idBits, idBits, VSigning::UNSIGNED),
+                                       VL_MASK_I(hiBits));
+        for (uint32_t block = 0; block < blockIds.size(); ++block) {
+            blockTableBuilder.addValue(block,
+                                       V3Number{nodep, static_cast<int>(idBits), blockIds[block]});
+        }
+
+        // Second level tables, the distinct blocks one after another
+        const uint32_t subEntries = nBlocks << loBits;
+        TableBuilder outputAssignedTableBuilder{fl};
+        outputAssignedTableBuilder.setTableSize(
+            nodep->findBitDType(m_outVarps.size(), m_outVarps.size(), VSigning::UNSIGNED),
+            subEntries - 1);
+        for (TableOutputVar& tov : m_outVarps) tov.setTableSize(subEntries - 1);
+        for (uint32_t subIndex = 0; subIndex < subEntries; ++subIndex) {
+            const uint32_t inValue
+                = blockFirsts[subIndex >> loBits] + (subIndex & VL_MASK_I(loBits));
+            const std::vector<uint64_t>& row = rowValues[rowIds[inValue]];
+            V3Number outputAssignedMask{nodep, static_cast<int>(m_outVarps.size()), 0};
+            outputAssignedMask.setQuad(row[0]);
+            outputAssignedTableBuilder.addValue(subIndex, outputAssignedMask);
+            for (TableOutputVar& tov : m_outVarps) {
+                V3Number outnum{nodep, tov.varScopep()->width(), 0};
+                outnum.setQuad(row[tov.ord() + 1]);
+                tov.addValue(subIndex, outnum);
+            }
+        }
+
+        // subIndex = {blockTable[index[high]], index[low]}
+        AstNode* const stmtsp = createLookupInput(fl, indexVscp);
+        AstNodeExpr* const blockp = new AstArraySel{
+            fl, new AstVarRef{fl, blockTableBuilder.varScopep(), VAccess::READ},
+            new AstSel{fl, new AstVarRef{fl, indexVscp, VAccess::READ}, static_cast<int>(loBits),
+                       static_cast<int>(hiBits)}};
+        AstNodeExpr* const lowp = new AstSel{fl, new AstVarRef{fl, indexVscp, VAccess::READ}, 0,
+                                             static_cast<int>(loBits)};
+        stmtsp->addNext(new AstAssign{fl, new AstVarRef{fl, subIndexVscp, VAccess::WRITE},
+                                      new AstConcat{fl, blockp, lowp}});
+        createOutputAssigns(nodep, stmtsp, subIndexVscp, outputAssignedTableBuilder.varScopep());
+
+        // Link it in.
+        // Keep sensitivity list, but delete all else
+        nodep->stmtsp()->unlinkFrBackWithNext()->deleteTree();
+        nodep->addStmtsp(stmtsp);
+        UINFOTREE(6, nodep, "", "table_split");
+    }
+
+    static uint32_t numberBlocks(const std::vector<uint32_t>& rowIds, unsigned loBits,
+                                 double maxBlocks, std::vector<uint32_t>& blockIds,
+                                 std::vector<uint32_t>& blockFirsts) {
+        // Number the distinct blocks of 2^loBits rows, returns the number distinct,
+        // or 0 as soon as there are more than maxBlocks distinct
+        std::map<std::vector<uint32_t>, uint32_t> blocks;
+        const size_t blockSize = 1ULL << loBits;
+        blockIds.clear();
+        blockFirsts.clear();
+        for (size_t first = 0; first < rowIds.size(); first += blockSize) {
+            std::vector<uint32_t> block{rowIds.begin() + first,
+                                        rowIds.begin() + first + blockSize};
+            const uint32_t nextId = static_cast<uint32_t>(blocks.size());
+            const auto pair = blocks.emplace(std::move(block), nextId);
+            if (pair.second) {
+                if (blocks.size() > maxBlocks) return 0;
+                blockFirsts.push_back(static_cast<uint32_t>(first));
+            }
+            blockIds.push_back(pair.first->second);
+        }
+        return static_cast<uint32_t>(blocks.size());
+    }
+
+    static unsigned blockIdBits(uint32_t nBlocks) {
+        unsigned bits = 1;
+        while ((1ULL << bits) < nBlocks) ++bits;
+        return bits;
+    }
+
+    AstVarScope* createIndexVar(FileLine* fl, const string& name, unsigned width) {
+        AstVar* const varp
+            = new AstVar{fl, VVarType::BLOCKTEMP, name, VFlagBitPacked{}, static_cast<int>(width)};
+        m_modp->addStmtsp(varp);
+        AstVarScope* const vscp = new AstVarScope{varp->fileline(), m_scopep, varp};
+        m_scopep->addVarsp(vscp);
+        return vscp;
+    }
+
+    void simulateInput(TableSimulateVisitor& simvis, AstAlways* nodep, uint32_t inValue) {
+        // Make a new simulation structure so we can set new input values
+        UINFO(8, " Simulating " << std::hex << inValue);
+
+        // Above simulateVisitor clears user 3, so
+        // all outputs default to nullptr to mean 'recirculating'.
+        simvis.clear();
+
+        // Set all inputs to the constant
+        uint32_t shift = 0;
+        for (AstVarScope* invscp : m_inVarps) {
+            // LSB is first variable, so extract it that way
+            const AstConst cnst{invscp->fileline(), AstConst::WidthedValue{}, invscp->width(),
+                                VL_MASK_I(invscp->width()) & (inValue >> shift)};
+            simvis.newValue(invscp, &cnst);
+            shift += invscp->width();
+            // We are using 32 bit arithmetic, because there's no way the input table can be
+            // 2^32 bytes!
+            UASSERT_OBJ(shift <= 32, nodep, "shift overflow");
+            UINFO(8, "   Input " << invscp->name() << " = " << cnst.name());
+        }
+
+        // Simulate
+        simvis.mainTableEmulate(nodep);
+        UASSERT_OBJ(simvis.optimizable(), simvis.whyNotNodep(),
+                    "Optimizable cleared, even though earlier test run said not: "
+                        << simvis.whyNotMessage());
+    }
+
     void createTables(AstAlways* nodep, TableBuilder& outputAssignedTableBuilder) {
         // Create table
         // There may be a simulation path by which the output doesn't change value.
@@ -287,32 +524,7 @@ private:
         TableSimulateVisitor simvis{this};
         for (uint32_t i = 0; i <= VL_MASK_I(m_inWidthBits); ++i) {
             const uint32_t inValue = i;
-            // Make a new simulation structure so we can set new input values
-            UINFO(8, " Simulating " << std::hex << inValue);
-
-            // Above simulateVisitor clears user 3, so
-            // all outputs default to nullptr to mean 'recirculating'.
-            simvis.clear();
-
-            // Set all inputs to the constant
-            uint32_t shift = 0;
-            for (AstVarScope* invscp : m_inVarps) {
-                // LSB is first variable, so extract it that way
-                const AstConst cnst{invscp->fileline(), AstConst::WidthedValue{}, invscp->width(),
-                                    VL_MASK_I(invscp->width()) & (inValue >> shift)};
-                simvis.newValue(invscp, &cnst);
-                shift += invscp->width();
-                // We are using 32 bit arithmetic, because there's no way the input table can be
-                // 2^32 bytes!
-                UASSERT_OBJ(shift <= 32, nodep, "shift overflow");
-                UINFO(8, "   Input " << invscp->name() << " = " << cnst.name());
-            }
-
-            // Simulate
-            simvis.mainTableEmulate(nodep);
-            UASSERT_OBJ(simvis.optimizable(), simvis.whyNotNodep(),
-                        "Optimizable cleared, even though earlier test run said not: "
-                            << simvis.whyNotMessage());
+            simulateInput(simvis, nodep, inValue);
 
             // Build output value tables and the assigned flags table
             V3Number outputAssignedMask{nodep, static_cast<int>(m_outVarps.size()), 0};
@@ -398,7 +610,11 @@ private:
         UINFO(4, "  ALWAYS  " << nodep);
         if (treeTest(nodep)) {
             // Well, then, I'll be a memory hog.
-            replaceWithTable(nodep);
+            if (m_split) {
+                replaceWithSplitTable(nodep);
+            } else {
+                replaceWithTable(nodep);
+            }
         }
     }
     void visit(AstNodeAssign* nodep) override {
@@ -412,6 +628,7 @@ public:
     explicit TableVisitor(AstNetlist* nodep) { iterate(nodep); }
     ~TableVisitor() override {  //
         V3Stats::addStat("Optimizations, Tables created", m_statTablesCre);
+        V3Stats::addStat("Optimizations, Tables split", m_statTablesSplit);
     }
 };
 
@@ -17,6 +17,9 @@
 //
 // Each module:
 //   Order module variables
+//   With --threads-pad-shared, start variables written by different
+//   threads on separate cache lines
+//   With --threads-first-touch, reset variables on the worker writing them
 //
 //*************************************************************************
 
@@ -36,6 +39,8 @@ VL_DEFINE_DEBUG_FUNCTIONS;
 
 using MTaskIdVec = std::vector<bool>;  // Used as a bit-set indexed by MTask ID
 using MTaskAffinityMap = std::unordered_map<const AstVar*, MTaskIdVec>;
+using ThreadIdSet = std::set<uint32_t>;  // Threads on which an MTask executes
+using VarWriterMap = std::unordered_map<const AstVar*, ThreadIdSet>;
 
 // Trace through code reachable form an MTask and annotate referenced variabels
 class GatherMTaskAffinity final : VNVisitorConst {
@@ -46,13 +51,17 @@ class GatherMTaskAffinity final : VNVisitorConst {
 
     // STATE
     MTaskAffinityMap& m_results;  // The result map being built;
+    VarWriterMap& m_writers;  // Threads writing each variable
     const uint32_t m_id;  // Id of mtask being analysed
+    const uint32_t m_threadId;  // Thread the mtask being analysed was scheduled on
     const size_t m_usedIds = ExecMTask::numUsedIds();  // Value of max id + 1
 
     // CONSTRUCTOR
-    GatherMTaskAffinity(const ExecMTask* mTaskp, MTaskAffinityMap& results)
+    GatherMTaskAffinity(const ExecMTask* mTaskp, MTaskAffinityMap& results, VarWriterMap& writers)
         : m_results{results}
-        , m_id{mTaskp->id()} {
+        , m_writers{writers}
+        , m_id{mTaskp->id()}
+        , m_threadId{mTaskp->threadId()} {
         iterateConst(mTaskp->funcp());
     }
     ~GatherMTaskAffinity() = default;
@@ -70,6 +79,8 @@ class GatherMTaskAffinity final : VNVisitorConst {
                                             std::forward_as_tuple(m_usedIds))
                                    .first->second;
         affinity[m_id] = true;
+        // Record writing thread
+        if (nodep->access().isWriteOrRW()) m_writers[varp].emplace(m_threadId);
     }
 
     void visit(AstCFunc* nodep) override {
@@ -85,8 +96,9 @@ class GatherMTaskAffinity final : VNVisitorConst {
     void visit(AstNode* nodep) override { iterateChildrenConst(nodep); }
 
 public:
-    static void apply(const ExecMTask* mTaskp, MTaskAffinityMap& results) {
-        GatherMTaskAffinity{mTaskp, results};
+    static void apply(const ExecMTask* mTaskp, MTaskAffinityMap& results,
+                      VarWriterMap& writers) {
+        GatherMTaskAffinity{mTaskp, results, writers};
     }
 };
 
@@ -125,6 +137,27 @@ public:
 
 uint32_t VarTspSorter::s_serialNext = 0;
 
+// Result of false sharing analysis of one module
+struct FalseSharing final {
+    size_t linesBefore = 0;  // Cache lines written by multiple threads before padding
+    size_t linesAfter = 0;  // Cache lines written by multiple threads after padding
+    // Variables moved to a new cache line, with their estimated offset
+    std::vector<std::pair<const AstVar*, uint64_t>> paddedVarps;
+};
+
+constexpr uint64_t LINE_BYTES = 64;  // Matches VL_CACHE_LINE_BYTES
+
+// Estimated size and alignment of variable storage
+static std::pair<uint64_t, uint64_t> varSizeAlign(const AstVar* varp) {
+    const AstNodeDType* const dtypep = varp->dtypeSkipRefp();
+    const AstBasicDType* const basicp = varp->basicp();
+    // Unknown size, assume the worst, a full cache line
+    if (!basicp || basicp->isOpaque() || varp->isSc()) return {LINE_BYTES, 8};
+    const uint64_t size = std::max(dtypep->widthTotalBytes(), 1);
+    const uint64_t align = std::min(std::max(dtypep->widthAlignBytes(), 1), 8);
+    return {size, align};
+}
+
 struct VarAttributes final {
     uint8_t stratum;  // Roughly equivalent to alignment requirement, to avoid padding
     bool anonOk;  // Can be emitted as part of anonymous structure
@@ -133,13 +166,27 @@ class VariableOrder final {
     std::unordered_map<const AstVar*, VarAttributes> m_attributes;
 
     const MTaskAffinityMap& m_mTaskAffinity;
+    const VarWriterMap& m_writers;
     std::vector<AstVar*>& m_varps;
+    FalseSharing& m_falseSharing;
 
     VariableOrder(AstNodeModule* modp, const MTaskAffinityMap& mTaskAffinity,
-                  std::vector<AstVar*>& varps)
+                  const VarWriterMap& writers, std::vector<AstVar*>& varps,
+                  FalseSharing& falseSharing)
         : m_mTaskAffinity{mTaskAffinity}
-        , m_varps{varps} {
+        , m_writers{writers}
+        , m_varps{varps}
+        , m_falseSharing{falseSharing} {
         orderModuleVars(modp);
+        if (v3Global.opt.mtasks() && !m_varps.empty() && !VN_IS(modp, Class)) {
+            m_falseSharing.linesBefore = countSharedLines();
+            if (v3Global.opt.threadsPadShared()) {
+                padSharedLines();
+                m_falseSharing.linesAfter = countSharedLines();
+            } else {
+                m_falseSharing.linesAfter = m_falseSharing.linesBefore;
+            }
+        }
     }
     ~VariableOrder() = default;
     VL_UNCOPYABLE(VariableOrder);
@@ -207,6 +254,76 @@ class VariableOrder final {
         sortAndAppend(m2v[emptyVec]);
     }
 
+    //######################################################################
+    // False sharing analysis. This estimates the layout of the emitted class
+    // members, which the module class aligns to a cache line.
+
+    static uint64_t roundUp(uint64_t offset, uint64_t align) {
+        return (offset + align - 1) / align * align;
+    }
+
+    // Count cache lines written by more than one thread
+    size_t countSharedLines() const {
+        std::map<uint64_t, ThreadIdSet> lineWriters;
+        uint64_t offset = 0;
+        for (const AstVar* const varp : m_varps) {
+            if (varp->isStatic()) continue;
+            const std::pair<uint64_t, uint64_t> sa = varSizeAlign(varp);
+            offset = roundUp(offset, varp->cacheLinePad() ? LINE_BYTES : sa.second);
+            const auto it = m_writers.find(varp);
+            if (it != m_writers.end()) {
+                const uint64_t lastLine = (offset + sa.first - 1) / LINE_BYTES;
+                for (uint64_t line = offset / LINE_BYTES; line <= lastLine; ++line) {
+                    lineWriters[line].insert(it->second.begin(), it->second.end());
+                }
+            }
+            offset += sa.first;
+        }
+        size_t count = 0;
+        for (const auto& pair : lineWriters) {
+            if (pair.second.size() > 1) ++count;
+        }
+        return count;
+    }
+
+    // Start a variable on a new cache line, if the line it would otherwise
+    // share is written by a different set of threads
+    void padSharedLines() {
+        ThreadIdSet lineWriters;  // Threads writing the current line so far
+        uint64_t currentLine = 0;
+        uint64_t offset = 0;
+        for (AstVar* const varp : m_varps) {
+            if (varp->isStatic()) continue;
+            const std::pair<uint64_t, uint64_t> sa = varSizeAlign(varp);
+            offset = roundUp(offset, sa.second);
+            if (offset / LINE_BYTES != currentLine) {
+                currentLine = offset / LINE_BYTES;
+                lineWriters.clear();
+            }
+            const auto it = m_writers.find(varp);
+            if (it != m_writers.end()) {
+                // Primary IO is declared with macros, can't align those
+                if (!lineWriters.empty() && lineWriters != it->second && !varp->isPrimaryIO()) {
+                    varp->setCacheLinePad();
+                    offset = roundUp(offset, LINE_BYTES);
+                    m_falseSharing.paddedVarps.emplace_back(varp, offset);
+                    lineWriters.clear();
+                }
+                lineWriters.insert(it->second.begin(), it->second.end());
+            }
+            offset += sa.first;
+            // If spilled onto the next line, only this variable is on it
+            if (offset / LINE_BYTES != currentLine) {
+                currentLine = offset / LINE_BYTES;
+                if (it != m_writers.end()) {
+                    lineWriters = it->second;
+                } else {
+                    lineWriters.clear();
+                }
+            }
+        }
+    }
+
     // cppcheck-suppress constParameterPointer
     void orderModuleVars(AstNodeModule* modp) {
         // Unlink all module variables from the module, compute attributes
@@ -243,8 +360,157 @@ class VariableOrder final {
 
 public:
     static void processModule(AstNodeModule* modp, const MTaskAffinityMap& mTaskAffinity,
-                              std::vector<AstVar*>& varps) VL_MT_STABLE {
-        VariableOrder{modp, mTaskAffinity, varps};
+                              const VarWriterMap& writers, std::vector<AstVar*>& varps,
+                              FalseSharing& falseSharing) VL_MT_STABLE {
+        VariableOrder{modp, mTaskAffinity, writers, varps, falseSharing};
+    }
+};
+
+//######################################################################
+// False sharing report
+
+static void reportFalseSharing(
+    const std::unordered_map<AstNodeModule*, FalseSharing>& falseSharing) {
+    size_t linesBefore = 0;
+    size_t linesAfter = 0;
+    size_t padded = 0;
+    for (AstNodeModule* modp = v3Global.rootp()->modulesp(); modp;
+         modp = VN_AS(modp->nextp(), NodeModule)) {
+        const auto it = falseSharing.find(modp);
+        if (it == falseSharing.end()) continue;
+        linesBefore += it->second.linesBefore;
+        linesAfter += it->second.linesAfter;
+        padded += it->second.paddedVarps.size();
+    }
+    V3Stats::addStat("Optimizations, Variable order false shared lines", linesBefore);
+    if (!v3Global.opt.threadsPadShared()) return;
+    V3Stats::addStat("Optimizations, Variable order false shared lines padded", linesAfter);
+    V3Stats::addStat("Optimizations, Variable order padded variables", padded);
+
+    const string filename
+        = v3Global.opt.makeDir() + "/" + v3Global.opt.prefix() + "__false_sharing.txt";
+    const std::unique_ptr<std::ofstream> ofp{V3File::new_ofstream(filename)};
+    if (ofp->fail()) v3fatal("Can't write file: " << filename);
+    *ofp << "Verilator false sharing report, --threads " << v3Global.opt.threads() << "\n\n";
+    *ofp << "Cache lines written by multiple threads (estimated):\n";
+    *ofp << "  Before padding: " << linesBefore << "\n";
+    *ofp << "  After padding:  " << linesAfter << "\n";
+    *ofp << "  Padded variables: " << padded << "\n";
+    for (AstNodeModule* modp = v3Global.rootp()->modulesp(); modp;
+         modp = VN_AS(modp->nextp(), NodeModule)) {
+        const auto it = falseSharing.find(modp);
+        if (it == falseSharing.end() || it->second.paddedVarps.empty()) continue;
+        *ofp << "\nModule " << modp->prettyName() << ": shared lines " << it->second.linesBefore
+             << " -> " << it->second.linesAfter << "\n";
+        for (const auto& pair : it->second.paddedVarps) {
+            *ofp << "  Moved to new cache line: " << pair.first->prettyName() << " (offset "
+                 << pair.second << ")\n";
+        }
+    }
+}
+
+//######################################################################
+// First touch placement (--threads-first-touch)
+//
+// The model is allocated untouched, so each page of model state is placed
+// on the NUMA node of the thread that first writes it. Move the reset of
+// variables written by only one worker thread into a function run on that
+// worker during construction. Thread 'threads - 1' of the static schedule
+// runs on the thread calling eval, which also constructs the model.
+
+class FirstTouch final {
+    // STATE
+    AstNodeModule* const m_modp;  // Top module
+    std::map<uint32_t, AstCFunc*> m_funcps;  // Reset function per worker
+    std::map<uint32_t, uint64_t> m_bytes;  // State bytes per worker
+    uint64_t m_sharedBytes = 0;  // State bytes written by several threads
+    std::unordered_map<const AstVar*, uint32_t> m_owners;  // Worker owning each variable
+    size_t m_movedVars = 0;  // Statistic tracking
+
+    AstCFunc* workerFuncp(uint32_t worker) {
+        AstCFunc*& funcpr = m_funcps[worker];
+        if (!funcpr) {
+            FileLine* const flp = m_modp->fileline();
+            funcpr = new AstCFunc{flp, "_ctor_var_reset__Vfirst_touch_" + cvtToStr(worker),
+                                  nullptr, "void"};
+            funcpr->isStatic(true);  // Uses void self pointer, so static and hand rolled
+            funcpr->isLoose(true);
+            funcpr->entryPoint(true);
+            funcpr->slow(true);
+            funcpr->argTypes("void* voidSelf, bool");
+            funcpr->addStmtsp(new AstCStmt{flp, EmitCUtil::voidSelfAssign(m_modp)});
+            funcpr->addStmtsp(new AstCStmt{flp, EmitCUtil::symClassAssign()});
+            m_modp->addStmtsp(funcpr);
+        }
+        return funcpr;
+    }
+
+    void moveResets(AstCFunc* funcp) {
+        for (AstNode *stmtp = funcp->stmtsp(), *nextp; stmtp; stmtp = nextp) {
+            nextp = stmtp->nextp();
+            const AstAssign* const assignp = VN_CAST(stmtp, Assign);
+            if (!assignp || !VN_IS(assignp->rhsp(), CReset)) continue;
+            const AstVarRef* const refp = VN_CAST(assignp->lhsp(), VarRef);
+            if (!refp) continue;
+            const auto it = m_owners.find(refp->varp());
+            if (it == m_owners.end()) continue;
+            workerFuncp(it->second)->addStmtsp(stmtp->unlinkFrBack());
+            ++m_movedVars;
+        }
+    }
+
+    // CONSTRUCTORS
+    FirstTouch(AstNodeModule* modp, const VarWriterMap& writers)
+        : m_modp{modp} {
+        const uint32_t mainThread = v3Global.opt.threads() - 1;
+        for (AstNode* nodep = modp->stmtsp(); nodep; nodep = nodep->nextp()) {
+            const AstVar* const varp = VN_CAST(nodep, Var);
+            if (!varp || varp->isStatic()) continue;
+            const auto it = writers.find(varp);
+            if (it == writers.end()) continue;
+            const uint64_t bytes = varSizeAlign(varp).first;
+            if (it->second.size() > 1) {
+                m_sharedBytes += bytes;
+            } else if (*it->second.begin() != mainThread && !varp->isPrimaryIO()) {
+                m_owners.emplace(varp, *it->second.begin());
+                m_bytes[*it->second.begin()] += bytes;
+            }
+        }
+
+        // Move resets out of _ctor_var_reset, which may have been split
+        AstCFunc* rootFuncp = nullptr;
+        for (AstNode* nodep = modp->stmtsp(); nodep; nodep = nodep->nextp()) {
+            AstCFunc* const funcp = VN_CAST(nodep, CFunc);
+            if (!funcp || !VString::startsWith(funcp->name(), "_ctor_var_reset")) continue;
+            if (funcp->name() == "_ctor_var_reset") rootFuncp = funcp;
+            if (!funcp->isStatic()) moveResets(funcp);
+        }
+        if (!rootFuncp || m_funcps.empty()) return;
+
+        // Run the reset functions on the owning workers, after the main thread's
+        FileLine* const flp = modp->fileline();
+        for (const auto& pair : m_funcps) {
+            AstCStmt* const cstmtp = new AstCStmt{flp};
+            rootFuncp->addStmtsp(cstmtp);
+            cstmtp->add("vlSymsp->__Vm_threadPoolp->firstTouch(" + cvtToStr(pair.first) + ", ");
+            cstmtp->add(new AstAddrOfCFunc{flp, pair.second});
+            cstmtp->add(", vlSelf, " + cvtToStr(m_bytes[pair.first]) + "ULL);");
+        }
+        rootFuncp->addStmtsp(new AstCStmt{flp, "vlSymsp->__Vm_threadPoolp->firstTouchDone("
+                                                    + cvtToStr(m_sharedBytes) + "ULL);"});
+    }
+    ~FirstTouch() {
+        uint64_t placed = 0;
+        for (const auto& pair : m_bytes) placed += pair.second;
+        V3Stats::addStat("Optimizations, First touch variables", m_movedVars);
+        V3Stats::addStat("Optimizations, First touch bytes placed", placed);
+        V3Stats::addStat("Optimizations, First touch bytes shared", m_sharedBytes);
+    }
+    VL_UNCOPYABLE(FirstTouch);
+
+public:
+    static void apply(AstNodeModule* modp, const VarWriterMap& writers) {
+        FirstTouch{modp, writers};
     }
 };
 
@@ -255,12 +521,13 @@ void V3VariableOrder::orderAll(AstNetlist* netlistp) {
     UINFO(2, __FUNCTION__ << ":");
 
     MTaskAffinityMap mTaskAffinity;
+    VarWriterMap writers;
 
     // Gather MTask affinities
     if (v3Global.opt.mtasks()) {
         netlistp->topModulep()->foreach([&](AstExecGraph* execGraphp) {
             for (const V3GraphVertex& vtx : execGraphp->depGraphp()->vertices()) {
-                GatherMTaskAffinity::apply(vtx.as<const ExecMTask>(), mTaskAffinity);
+                GatherMTaskAffinity::apply(vtx.as<const ExecMTask>(), mTaskAffinity, writers);
             }
         });
     }
@@ -268,18 +535,22 @@ void V3VariableOrder::orderAll(AstNetlist* netlistp) {
 
     // Sort variables for each module
     std::unordered_map<AstNodeModule*, std::vector<AstVar*>> sortedVars;
+    std::unordered_map<AstNodeModule*, FalseSharing> falseSharing;
     {
         V3ThreadScope threadScope;
 
         for (AstNodeModule* modp = v3Global.rootp()->modulesp(); modp;
              modp = VN_AS(modp->nextp(), NodeModule)) {
             std::vector<AstVar*>& varps = sortedVars[modp];
-            threadScope.enqueue([modp, &mTaskAffinity, &varps]() {
-                VariableOrder::processModule(modp, mTaskAffinity, varps);
+            FalseSharing& modFalseSharing = falseSharing[modp];
+            threadScope.enqueue([modp, &mTaskAffinity, &writers, &varps, &modFalseSharing]() {
+                VariableOrder::processModule(modp, mTaskAffinity, writers, varps,
+                                             modFalseSharing);
             });
         }
     }
     if (v3Global.opt.stats()) V3Stats::statsStage("variableorder-sort");
+    if (v3Global.opt.mtasks()) reportFalseSharing(falseSharing);
 
     // Insert them back under the module, in the new order, but at
     // the front of the list so they come out first in dumps/JSON.
@@ -304,6 +575,13 @@ void V3VariableOrder::orderAll(AstNetlist* netlistp) {
         }
     }
 
+    // Worker threads are only known for static, non-hierarchical schedules
+    if (v3Global.opt.mtasks() && v3Global.opt.threadsFirstTouch()
+        && !v3Global.opt.threadsSharedQueue() && !v3Global.opt.hierChild()
+        && v3Global.opt.hierBlocks().empty()) {
+        FirstTouch::apply(netlistp->topModulep(), writers);
+    }
+
     // Done
     V3Global::dumpCheckGlobalTree("variableorder", 0, dumpTreeEitherLevel() >= 3);
 }
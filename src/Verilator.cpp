@@ -22,6 +22,7 @@
 #include "V3AssertPre.h"
 #include "V3AssertProp.h"
 #include "V3Ast.h"
+#include "V3AstArena.h"
 #include "V3Begin.h"
 #include "V3Branch.h"
 #include "V3Broken.h"
@@ -60,6 +61,7 @@
 #include "V3Global.h"
 #include "V3Graph.h"
 #include "V3HierBlock.h"
+#include "V3Incremental.h"
 #include "V3Inline.h"
 #include "V3InlineCFuncs.h"
 #include "V3Inst.h"
@@ -141,7 +143,8 @@ static void emitSerialized() VL_MT_DISABLED {
     if (v3Global.opt.jsonOnly()) emitJson();
 }
 
-static void process() {
+static bool process() {
+    // Return false if skipped as unchanged
     {
         VlOs::DeltaWallTime elabWallTime{true};
 
@@ -195,10 +198,20 @@ static void process() {
             // The actual Verilation will be done based on this plan.
             if (v3Global.hierGraphp()) {
                 reportStatsIfEnabled();
-                return;
+                return true;
             }
         }
 
+        // Skip the rest if the netlist is the same as the previous run
+        if (v3Global.opt.incremental() && !v3Global.opt.lintOnly()
+            && !v3Global.opt.serializeOnly() && !v3Global.opt.dpiHdrOnly()
+            && V3Incremental::checkUnchanged(v3Global.rootp())) {
+            return false;
+        }
+        if (v3Global.opt.incremental()) {
+            V3Os::unlinkRegexp(v3Global.opt.hierTopDataDir(), v3Global.opt.prefix() + "_*.txt");
+        }
+
         // Calculate and check widths, edit tree to TRUNC/EXTRACT any width mismatches
         V3Width::width(v3Global.rootp());
 
@@ -564,6 +577,9 @@ static void process() {
                 V3Reloop::reloopAll(v3Global.rootp());
             }
 
+            // Name branches for profiling, before CFunc inlining copies them
+            V3Branch::pgoKeyAll(v3Global.rootp());
+
             if (v3Global.opt.inlineCFuncs()) {
                 // Inline small CFuncs to reduce function call overhead
                 V3InlineCFuncs::inlineAll(v3Global.rootp());
@@ -576,6 +592,12 @@ static void process() {
             // Branch prediction
             V3Branch::branchAll(v3Global.rootp());
 
+            if (v3Global.opt.fMergeCond() && v3Global.opt.fMergeCondSelect()) {
+                // Convert small conditionals to branchless selects
+                // Must be after V3Branch, so branch prediction hints are known
+                V3MergeCond::selectAll(v3Global.rootp());
+            }
+
             // Add C casts when longs need to become long-long and vice-versa
             // Note depth may insert something needing a cast, so this must be last.
             V3Cast::castAll(v3Global.rootp());
@@ -613,6 +635,8 @@ static void process() {
         // Output the text
         if (!v3Global.opt.lintOnly() && !v3Global.opt.serializeOnly()
             && !v3Global.opt.dpiHdrOnly()) {
+            // Rename functions by content before anything refers to their names
+            if (v3Global.opt.outputSplitStable()) V3EmitC::emitcStableNames();
             // emitcInlines is first, as it may set needHInlines which other emitters read
             V3EmitC::emitcInlines();
             V3EmitC::emitcSyms();
@@ -666,6 +690,7 @@ static void process() {
 
     // Final statistics
     if (v3Global.opt.stats()) V3Stats::statsStage("emit");
+    return true;
 }
 
 static bool verilate(const string& argString) {
@@ -700,7 +725,11 @@ static bool verilate(const string& argString) {
     // potentially disruptive to old behavior, and --skip-identical
     V3Os::unlinkRegexp(v3Global.opt.hierTopDataDir(), v3Global.opt.prefix() + "_*.dot");
     V3Os::unlinkRegexp(v3Global.opt.hierTopDataDir(), v3Global.opt.prefix() + "_*.tree");
-    V3Os::unlinkRegexp(v3Global.opt.hierTopDataDir(), v3Global.opt.prefix() + "_*.txt");
+    // With --incremental, reports are targets of the previous run, so removed only
+    // once the netlist is known to have changed
+    if (!v3Global.opt.incremental()) {
+        V3Os::unlinkRegexp(v3Global.opt.hierTopDataDir(), v3Global.opt.prefix() + "_*.txt");
+    }
 
     // Internal tests (after option parsing as need debug() setting,
     // and after removing files as may make debug output)
@@ -721,6 +750,7 @@ static bool verilate(const string& argString) {
         V3Broken::selfTest();
         V3Control::selfTest();
         V3ThreadPool::selfTest();
+        V3AstArena::selfTest();
         UINFO(2, "selfTest done");
     }
 
@@ -728,9 +758,19 @@ static bool verilate(const string& argString) {
     v3Global.readFiles();
     v3Global.removeStd();
 
+    // Reuse the outputs of an earlier run with the same inputs
+    if (V3Incremental::restoreCached(argString)) {
+        UINFO(1, "--verilate-cache: Reused cached outputs, exiting");
+        return false;
+    }
+
     // Link, etc, if needed
     if (!v3Global.opt.preprocOnly()) {  //
-        process();
+        if (!process()) {
+            V3Error::abortIfWarnings();
+            UINFO(1, "--incremental: No change to the linked netlist, exiting");
+            return false;
+        }
     }
 
     // Final steps
@@ -783,6 +823,8 @@ static bool verilate(const string& argString) {
                                + "__verFiles.dat",
                            argString);
     }
+    if (v3Global.opt.incremental() && !V3Error::isErrorOrWarn()) V3Incremental::writeDigest();
+    if (!V3Error::isErrorOrWarn()) V3Incremental::storeCached();
 
     V3Os::filesystemFlushBuildDir(v3Global.opt.makeDir());
     if (v3Global.opt.hierTop()) V3Os::filesystemFlushBuildDir(v3Global.opt.hierTopDataDir());
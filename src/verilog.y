@@ -273,6 +273,7 @@ BISONPRE_VERSION(3.7,%define api.header.include {"V3ParseBison.h"})
 %token<fl>              yVLT_TRACING_ON             "tracing_on"
 
 %token<fl>              yVLT_D_BLOCK    "--block"
+%token<fl>              yVLT_D_BRANCH   "--branch"
 %token<fl>              yVLT_D_CONTENTS "--contents"
 %token<fl>              yVLT_D_COST     "--cost"
 %token<fl>              yVLT_D_FILE     "--file"
@@ -8199,6 +8200,10 @@ vltItem:
                         { V3Control::addProfileData($<fl>1, *$2, $3->toUQuad()); }
         |       yVLT_PROFILE_DATA vltDModel vltDMtask vltDCost
                         { V3Control::addProfileData($<fl>1, *$2, *$3, $4->toUQuad()); }
+        |       yVLT_PROFILE_DATA vltDModel vltDBranch vltDCost
+                        { V3Control::addBranchProfileData($<fl>1, *$2, *$3, $4->toUQuad()); }
+        |       yVLT_PROFILE_DATA vltDModel vltDFunction vltDCost
+                        { V3Control::addFunctionProfileData($<fl>1, *$2, *$3, $4->toUQuad()); }
         ;
 
 vltOffFront<errcodeen>:
@@ -8225,6 +8230,10 @@ vltDBlock<strp>:  // --block <arg>
                 yVLT_D_BLOCK str                        { $$ = $2; }
         ;
 
+vltDBranch<strp>:  // --branch <arg>
+                yVLT_D_BRANCH str                       { $$ = $2; }
+        ;
+
 vltDContents<strp>:
                 yVLT_D_CONTENTS str                     { $$ = $2; }
         ;
@@ -8237,6 +8246,10 @@ vltDFile<strp>:  // --file <arg>
                 yVLT_D_FILE str                         { $$ = $2; }
         ;
 
+vltDFunction<strp>:  // --function <arg>
+                yVLT_D_FUNCTION str                     { $$ = $2; }
+        ;
+
 vltDHierDpi<strp>:  // --hier-dpi <arg>
                 yVLT_D_HIER_DPI str                     { $$ = $2; }
         ;
@@ -0,0 +1,63 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain.
+// SPDX-FileCopyrightText: 2026 Wilson Snyder
+// SPDX-License-Identifier: CC0-1.0
+
+module t (/*AUTOARG*/
+   // Inputs
+   clk
+   );
+   input clk;
+
+   integer cyc = 0;
+   logic [31:0] addr;
+   logic [7:0] sel;
+
+   // Sparse 32-bit address decoder, too wide for a lookup table
+   always_comb begin
+      case (addr)
+        32'h0000_0000: sel = 8'd1;
+        32'h0000_0004: sel = 8'd2;
+        32'h0000_0008: sel = 8'd3;
+        32'h0000_0010: sel = 8'd4;
+        32'h0000_0100: sel = 8'd5;
+        32'h0000_1000: sel = 8'd6;
+        32'h0001_0000: sel = 8'd7;
+        32'h0010_0000, 32'h0010_0004: sel = 8'd8;
+        32'h0100_0000: sel = 8'd9;
+        32'h1000_0000: sel = 8'd10;
+        32'h2000_0000: sel = 8'd11;
+        32'h4000_0000: sel = 8'd12;
+        32'h8000_0000: sel = 8'd13;
+        32'h8000_0004: sel = 8'd14;
+        32'hf000_0000: sel = 8'd15;
+        32'hffff_fffc: sel = 8'd16;
+        32'hffff_ffff: sel = 8'd17;
+        32'h0000_0004: sel = 8'd99;  // Duplicate, earlier item has priority
+        default: sel = 8'd0;
+      endcase
+   end
+
+   always @(posedge clk) begin
+      cyc <= cyc + 1;
+      case (cyc)
+        0: addr <= 32'h0000_0000;
+        1: begin addr <= 32'h0000_0004; if (sel != 8'd1) $stop; end
+        2: begin addr <= 32'h0010_0004; if (sel != 8'd2) $stop; end
+        3: begin addr <= 32'h8000_0004; if (sel != 8'd8) $stop; end
+        4: begin addr <= 32'hffff_ffff; if (sel != 8'd14) $stop; end
+        5: begin addr <= 32'h0000_0005; if (sel != 8'd17) $stop; end
+        6: begin addr <= 32'hffff_fffd; if (sel != 8'd0) $stop; end
+        7: begin addr <= 32'h0000_0010; if (sel != 8'd0) $stop; end
+        8: begin addr <= 32'hf000_0000; if (sel != 8'd4) $stop; end
+        9: begin
+           if (sel != 8'd15) $stop;
+           $write("*-* All Finished *-*\n");
+           $finish;
+        end
+        default: ;
+      endcase
+   end
+
+endmodule
@@ -0,0 +1,67 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain.
+// SPDX-FileCopyrightText: 2026 Wilson Snyder
+// SPDX-License-Identifier: CC0-1.0
+
+`define stop $stop
+`define check(got ,exp) do if ((got) !== (exp)) begin $write("%%Error: %s:%0d: cyc=%0d got='h%x exp='h%x\n", `__FILE__,`__LINE__, cyc, (got), (exp)); `stop; end while(0)
+
+// Library cells, as in a synthesized netlist
+module AND2 (input A, input B, output Y);
+   assign Y = A & B;
+endmodule
+module XOR2 (input A, input B, output Y);
+   assign Y = A ^ B;
+endmodule
+module AOI21 (input A0, input A1, input B, output Y);
+   assign Y = ~((A0 & A1) | B);
+endmodule
+module MUX2 (input A, input B, input S, output Y);
+   assign Y = S ? B : A;
+endmodule
+
+module t (/*AUTOARG*/
+   // Inputs
+   clk
+   );
+   input clk;
+
+   integer cyc = 0;
+   reg [63:0] crc = 64'h5aef0c8d_d70a4497;
+   reg [63:0] a = 0;
+   reg [63:0] b = 0;
+   reg [63:0] c = 0;
+   always @(posedge clk) begin
+      a <= crc;
+      b <= {crc[31:0], crc[63:32]};
+      c <= crc ^ {crc[62:0], crc[63]};
+   end
+
+   // Gate level netlist, one cell per bit
+   wire [63:0] n_and;
+   wire [63:0] n_xor;
+   wire [63:0] n_aoi;
+   wire [63:0] n_mux;
+   for (genvar i = 0; i < 64; ++i) begin : g_bit
+      AND2 u_and (.A(a[i]), .B(b[i]), .Y(n_and[i]));
+      XOR2 u_xor (.A(n_and[i]), .B(c[i]), .Y(n_xor[i]));
+      AOI21 u_aoi (.A0(a[i]), .A1(c[i]), .B(b[i]), .Y(n_aoi[i]));
+      MUX2 u_mux (.A(n_xor[i]), .B(n_aoi[i]), .S(crc[5]), .Y(n_mux[i]));
+   end
+
+   always @ (posedge clk) begin
+      cyc <= cyc + 1;
+      crc <= {crc[62:0], crc[63] ^ crc[2] ^ crc[0]};
+      if (cyc > 1) begin
+         `check(n_and, a & b);
+         `check(n_xor, (a & b) ^ c);
+         `check(n_aoi, ~((a & c) | b));
+         `check(n_mux, crc[5] ? ~((a & c) | b) : (a & b) ^ c);
+      end
+      if (cyc == 99) begin
+         $write("*-* All Finished *-*\n");
+         $finish;
+      end
+   end
+endmodule
@@ -180,6 +180,10 @@ module t (
    `signal(REPLACE_NESTED_CONCAT_OF_ADJOINING_SELS_ON_RHS_CAT, {rand_b, rand_a[10:3]});
    `signal(REPLACE_NESTED_CONCAT_OF_ADJOINING_SELS_ON_LHS, {rand_a[10:3], {rand_a[2:1], rand_b}});
    `signal(REPLACE_NESTED_CONCAT_OF_ADJOINING_SELS_ON_RHS, {{rand_b, rand_a[10:3]}, rand_a[2:1]});
+   `signal(REPLACE_CONCAT_OF_BIT_SLICES, {rand_a[1] & rand_b[1], rand_a[0] & rand_b[0]});
+   `signal(REPLACE_CONCAT_OF_BIT_SLICES_SWAPPED, {rand_a[5] | rand_b[5], rand_b[4] | rand_a[4]});
+   `signal(REPLACE_CONCAT_OF_BIT_SLICES_DEEP, {rand_a[9] ? ~(rand_a[3] ^ rand_b[3]) : rand_b[7], rand_a[9] ? ~(rand_a[2] ^ rand_b[2]) : rand_b[6]});
+   `signal(REPLACE_NESTED_CONCAT_OF_BIT_SLICES_ON_LHS, {rand_a[2] ^ rand_b[2], {rand_a[1] ^ rand_b[1], rand_b[9:4]}});
    `signal(REMOVE_COND_WITH_FALSE_CONDITION, 1'd0 ? rand_a : rand_b);
    `signal(REMOVE_COND_WITH_TRUE_CONDITION, 1'd1 ? rand_a : rand_b);
    `signal(REMOVE_COND_WITH_BRANCHES_SAME, rand_a[0] ? ~rand_b : ~rand_b);
@@ -0,0 +1,58 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# This program is free software; you can redistribute it and/or modify it
+# under the terms of either the GNU Lesser General Public License Version 3
+# or the Perl Artistic License Version 2.0.
+# SPDX-FileCopyrightText: 2026 Wilson Snyder
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+import time
+
+test.scenarios('vlt')
+test.top_filename = test.obj_dir + "/" + test.name + ".v"
+
+wholefile = test.file_contents(test.t_dir + "/" + test.name + ".v")
+test.write_wholefile(test.top_filename, wholefile)
+
+test.compile(verilator_flags2=['--incremental'])
+test.execute()
+
+out_filename = test.obj_dir + "/V" + test.name + ".cpp"
+test.file_grep(test.obj_dir + "/V" + test.name + "__verIncr.dat", r'^H ')
+oldtime = os.path.getmtime(out_filename)
+
+time.sleep(2)  # Or else it might take < 1 second to compile and see no diff.
+
+print("\nTest comment change is skipped")
+test.write_wholefile(test.top_filename, wholefile + "// Comment only change\n")
+test.compile(verilator_flags2=['--incremental'])
+if os.path.getmtime(out_filename) != oldtime:
+    test.error("--incremental was ignored -- regenerated " + out_filename)
+test.execute()
+
+print("\nTest netlist change is rebuilt")
+wholefile = re.sub(r'\$write', '$display("Changed");\n    $write', wholefile)
+test.write_wholefile(test.top_filename, wholefile)
+test.compile(verilator_flags2=['--incremental'])
+if os.path.getmtime(out_filename) == oldtime:
+    test.error("--incremental skipped a changed netlist -- kept " + out_filename)
+test.execute()
+test.file_grep(test.run_log_filename, r'Changed')
+
+print("\nTest control file change is rebuilt")
+# Control file data, e.g. profile_data, is not in the netlist
+vlt_filename = test.obj_dir + "/" + test.name + ".vlt"
+vlt_lint_off = "`verilator_config\nlint_off -rule %s -file \"*nomatch*\"\n"
+test.write_wholefile(vlt_filename, vlt_lint_off % "UNUSED")
+test.compile(verilator_flags2=['--incremental', vlt_filename])
+oldtime = os.path.getmtime(out_filename)
+time.sleep(2)
+test.write_wholefile(vlt_filename, vlt_lint_off % "WIDTH")
+test.compile(verilator_flags2=['--incremental', vlt_filename])
+if os.path.getmtime(out_filename) == oldtime:
+    test.error("--incremental skipped a changed control file -- kept " + out_filename)
+test.execute()
+
+test.passes()
@@ -0,0 +1,38 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# This program is free software; you can redistribute it and/or modify it
+# under the terms of either the GNU Lesser General Public License Version 3
+# or the Perl Artistic License Version 2.0.
+# SPDX-FileCopyrightText: 2026 Wilson Snyder
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+import time
+
+test.scenarios('vltmt')
+test.top_filename = "t/t_gen_alw.v"  # It doesn't really matter what test
+
+flags = ['--incremental', '--report-parallelism', '--threads-pad-shared']
+out_filename = test.obj_dir + "/" + test.vm_prefix + ".cpp"
+reports = [
+    test.obj_dir + "/" + test.vm_prefix + "__parallelism.txt",
+    test.obj_dir + "/" + test.vm_prefix + "__false_sharing.txt"
+]
+
+test.compile(verilator_flags2=flags, threads=2)
+oldtime = os.path.getmtime(out_filename)
+
+for run in (2, 3):
+    time.sleep(2)  # Or else it might take < 1 second to compile and see no diff.
+    print("\nTest run " + str(run) + " is skipped, and keeps the reports")
+    test.compile(verilator_flags2=flags, threads=2)
+    if os.path.getmtime(out_filename) != oldtime:
+        test.error("--incremental run " + str(run) + " regenerated " + out_filename)
+    for report in reports:
+        if not os.path.exists(report):
+            test.error("--incremental run " + str(run) + " lost " + report)
+
+test.execute()
+
+test.passes()
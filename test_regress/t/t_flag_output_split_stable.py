@@ -0,0 +1,48 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# This program is free software; you can redistribute it and/or modify it
+# under the terms of either the GNU Lesser General Public License Version 3
+# or the Perl Artistic License Version 2.0.
+# SPDX-FileCopyrightText: 2026 Wilson Snyder
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('vlt')
+test.top_filename = test.obj_dir + "/t_flag_csplit.v"
+
+wholefile = test.file_contents(test.t_dir + "/t_flag_csplit.v")
+test.write_wholefile(test.top_filename, wholefile)
+
+flags = ['--output-split 1', '--output-split-cfuncs 1', '--output-split-stable', '--stats']
+
+
+def stable_files():
+    contents = {}
+    for filename in test.glob_some(test.obj_dir + "/" + test.vm_prefix + "___024root__h*.cpp"):
+        contents[filename] = test.file_contents(filename)
+    return contents
+
+
+test.compile(verilator_flags2=flags)
+test.execute()
+test.file_grep(test.stats, r'EmitC, Stable function names\s+(\d+)')
+before = stable_files()
+if len(before) < 2:
+    test.error("Expected multiple content named files")
+
+print("\nTest local change keeps other files")
+wholefile = re.sub(r'\$write\("\*-\*', '$display("Changed");\n         $write("*-*', wholefile)
+test.write_wholefile(test.top_filename, wholefile)
+for filename in before:
+    os.remove(filename)  # So only files of the new run are compared
+test.compile(verilator_flags2=flags)
+test.execute()
+test.file_grep(test.run_log_filename, r'Changed')
+after = stable_files()
+same = [filename for filename in before if after.get(filename) == before[filename]]
+if not same:
+    test.error("Local change altered every content named file")
+
+test.passes()
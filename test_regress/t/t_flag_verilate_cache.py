@@ -0,0 +1,36 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# This program is free software; you can redistribute it and/or modify it
+# under the terms of either the GNU Lesser General Public License Version 3
+# or the Perl Artistic License Version 2.0.
+# SPDX-FileCopyrightText: 2026 Wilson Snyder
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('vlt')
+test.top_filename = "t/t_flag_incremental.v"
+
+cache_dir = test.obj_dir + "/cache"
+out_name = "V" + test.name + ".cpp"
+
+test.compile(verilator_flags2=['--verilate-cache', cache_dir])
+test.execute()
+
+# Mark the cached copy of the model, so we can tell it was used
+manifests = glob.glob(cache_dir + "/*/manifest")
+if len(manifests) != 1:
+    test.error("Expected one cache entry, got " + str(manifests))
+entry_dir = os.path.dirname(manifests[0])
+cached = test.file_grep(manifests[0], r'^(f\d+) ' + out_name + '$')
+with open(entry_dir + "/" + cached[0][0], 'a', encoding="utf8") as fh:
+    fh.write("// Restored from --verilate-cache\n")
+
+print("\nTest outputs are restored from the cache")
+os.remove(test.obj_dir + "/" + out_name)
+test.compile(verilator_flags2=['--verilate-cache', cache_dir])
+test.file_grep(test.obj_dir + "/" + out_name, r'Restored from --verilate-cache')
+test.execute()
+
+test.passes()
@@ -0,0 +1,38 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# This program is free software; you can redistribute it and/or modify it
+# under the terms of either the GNU Lesser General Public License Version 3
+# or the Perl Artistic License Version 2.0.
+# SPDX-FileCopyrightText: 2026 Wilson Snyder
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+
+# Test for bin/verilator_gantt thread wait statistics
+
+import vltest_bootstrap
+
+test.scenarios('vltmt')
+test.top_filename = "t/t_gantt.v"
+test.pli_filename = "t/t_gantt_c.cpp"
+
+test.compile(verilator_flags2=["--prof-exec", test.pli_filename], threads=4)
+
+for policy in ["spin", "adaptive", "block"]:
+    test.execute(all_run_flags=[
+        "+verilator+threads+wait+" + policy, " +verilator+prof+exec+start+2",
+        " +verilator+prof+exec+window+2",
+        " +verilator+prof+exec+file+" + test.obj_dir + "/profile_exec.dat"
+    ])
+
+    gantt_log = test.obj_dir + "/gantt_" + policy + ".log"
+    test.run(cmd=[
+        os.environ["VERILATOR_ROOT"] + "/bin/verilator_gantt", "--no-vcd", test.obj_dir +
+        "/profile_exec.dat", "| tee " + gantt_log
+    ])
+
+    test.file_grep(gantt_log, r'Thread waits for mtask dependencies:')
+    test.file_grep(gantt_log, r'Wait policy += ' + policy)
+    test.file_grep(gantt_log, r'\s+main \|')
+
+test.passes()
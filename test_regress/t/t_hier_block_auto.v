@@ -0,0 +1,54 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain.
+// SPDX-FileCopyrightText: 2026 Wilson Snyder
+// SPDX-License-Identifier: CC0-1.0
+
+module t (  /*AUTOARG*/
+    // Inputs
+    clk
+);
+  input clk;
+
+  localparam W = 4096;
+
+  integer cyc = 0;
+  logic [W-1:0] a;
+  logic [W-1:0] b;
+  wire [W-1:0] o0;
+  wire [W-1:0] o1;
+  wire [W-1:0] o2;
+  wire [W-1:0] o3;
+
+  assign a = {(W / 32) {cyc}};
+  assign b = {(W / 32) {~cyc}};
+
+  sub u_sub0 (.a(a), .b(b), .o(o0));
+  sub u_sub1 (.a(a), .b(b), .o(o1));
+  sub u_sub2 (.a(b), .b(a), .o(o2));
+  sub u_sub3 (.a(b), .b(a), .o(o3));
+
+  always @(posedge clk) begin
+    cyc <= cyc + 1;
+    if (cyc > 1) begin
+      if (o0 != o1) $stop;
+      if (o2 != o3) $stop;
+      if (o0 == '0) $stop;
+    end
+    if (cyc == 9) begin
+      $write("*-* All Finished *-*\n");
+      $finish;
+    end
+  end
+endmodule
+
+// Large enough to be chosen as a hierarchical block
+module sub (
+    input logic [4095:0] a,
+    input logic [4095:0] b,
+    output logic [4095:0] o
+);
+  for (genvar i = 0; i < 4096; ++i) begin : g_bit
+    assign o[i] = (a[i] & b[(i + 1) % 4096]) ^ (a[(i + 2) % 4096] | b[(i + 3) % 4096]);
+  end
+endmodule
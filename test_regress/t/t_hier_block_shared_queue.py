@@ -0,0 +1,33 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# This program is free software; you can redistribute it and/or modify it
+# under the terms of either the GNU Lesser General Public License Version 3
+# or the Perl Artistic License Version 2.0.
+# SPDX-FileCopyrightText: 2026 Wilson Snyder
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+
+import vltest_bootstrap
+
+test.priority(30)
+test.scenarios('vltmt')
+test.top_filename = "t/t_hier_block_perf.v"
+
+test.cycles = 1000
+test.sim_time = test.cycles * 10 + 1000
+
+config_file = test.t_dir + "/t_hier_block_perf.vlt"
+
+test.compile(v_flags2=[
+    config_file, "+define+SIM_CYCLES=" + str(test.cycles), "--hierarchical", "--stats",
+    "--threads-shared-queue", "-Wno-UNOPTFLAT", "-DWORKERS=2", "--hierarchical-threads 4"
+],
+             threads=2,
+             context_threads=4)
+
+test.file_grep(test.stats, r'Optimizations, Thread shared queue tasks\s+(\d+)')
+
+test.execute()
+
+test.passes()
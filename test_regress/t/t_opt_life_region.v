@@ -0,0 +1,91 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain.
+// SPDX-FileCopyrightText: 2026 Wilson Snyder
+// SPDX-License-Identifier: CC0-1.0
+
+module t (/*AUTOARG*/
+   // Inputs
+   clk
+   );
+   input clk;
+
+   integer cyc = 0;
+   logic [31:0] mem [7:0];
+   logic [31:0] acc = 0;
+   logic [31:0] base = 0;
+   logic [31:0] sum_a = 0;
+   logic [31:0] sum_b = 0;
+
+   // verilator lint_off MULTIDRIVEN
+   logic [31:0] scratch = 0;
+   // verilator lint_on MULTIDRIVEN
+   logic [31:0] seen_a = 0;
+   logic [31:0] seen_b = 0;
+
+   // Called from two processes, so must not be optimized for either caller alone
+   function automatic logic [31:0] from_base(logic [31:0] v);
+      // verilator no_inline_task
+      return base + v;
+   endfunction
+
+   // Called from two processes, the store must be kept though one caller overwrites it
+   task automatic set_scratch(logic [31:0] v);
+      // verilator no_inline_task
+      scratch = v;
+   endtask
+
+   initial begin
+      for (int i = 0; i < 8; i = i + 1) mem[i] = 0;
+   end
+
+   // Array NBA commit flags are set and read within the same NBA region
+   always @(posedge clk) begin
+      mem[cyc[2:0]] <= cyc * 3;
+   end
+
+   always @(posedge clk) begin
+      acc <= acc + mem[cyc[2:0] - 3'd1];
+   end
+
+   always @(posedge clk) begin
+      base <= cyc * 2;
+   end
+
+   always @(posedge clk) begin
+      sum_a <= sum_a + from_base(1);
+   end
+
+   always @(posedge clk) begin
+      sum_b <= sum_b + from_base(3);
+   end
+
+   always @(posedge clk) begin
+      set_scratch(cyc + 7);
+      seen_a <= scratch;
+   end
+
+   // Sees the store from the other caller, then overwrites it
+   always @(negedge clk) begin
+      seen_b <= scratch;
+      set_scratch(0);
+   end
+
+   always @(posedge clk) begin
+      cyc <= cyc + 1;
+      if (cyc == 20) begin
+`ifdef TEST_VERBOSE
+         $write("[%0t] acc=%0d sum_a=%0d sum_b=%0d seen_a=%0d seen_b=%0d\n", $time, acc,
+                sum_a, sum_b, seen_a, seen_b);
+`endif
+         if (acc != 513) $stop;
+         if (sum_a != 362) $stop;
+         if (sum_b != 402) $stop;
+         if (seen_a != 26) $stop;
+         if (seen_b != 26) $stop;
+         $write("*-* All Finished *-*\n");
+         $finish;
+      end
+   end
+
+endmodule
@@ -0,0 +1,22 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# This program is free software; you can redistribute it and/or modify it
+# under the terms of either the GNU Lesser General Public License Version 3
+# or the Perl Artistic License Version 2.0.
+# SPDX-FileCopyrightText: 2026 Wilson Snyder
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('vlt_all')
+test.top_filename = "t/t_opt_merge_cond_select.v"
+
+test.compile(verilator_flags2=["--stats", "-fno-merge-cond-select"])
+
+test.execute()
+
+if test.vlt:
+    test.file_grep_not(test.stats, r'Optimizations, MergeCond selects\s+(\d+)')
+
+test.passes()
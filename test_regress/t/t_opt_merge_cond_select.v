@@ -0,0 +1,81 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain.
+// SPDX-FileCopyrightText: 2026 Wilson Snyder
+// SPDX-License-Identifier: CC0-1.0
+
+`define stop $stop
+`define check(got ,exp) do if ((got) !== (exp)) begin $write("%%Error: %s:%0d: cyc=%0d got='h%x exp='h%x\n", `__FILE__,`__LINE__, cyc, (got), (exp)); `stop; end while(0)
+
+module t (/*AUTOARG*/
+   // Inputs
+   clk
+   );
+   input clk;
+
+   integer cyc = 0;
+   reg [63:0] crc = 64'h5aef0c8d_d70a4497;
+
+   wire [7:0] a8 = crc[7:0];
+   wire [7:0] b8 = crc[15:8];
+   wire [31:0] a32 = crc[31:0];
+   wire [31:0] b32 = crc[63:32];
+   wire [63:0] a64 = crc;
+   wire [63:0] b64 = {crc[31:0], crc[63:32]};
+
+   // Data dependent conditionals, converted to branchless selects
+   reg [7:0] x8;
+   reg [31:0] x32;
+   reg [31:0] y32;
+   reg [63:0] x64;
+   reg [31:0] hold = 0;
+   always @(posedge clk) begin
+      if (crc[3]) begin
+         x8 <= a8 + b8;
+         x32 <= a32 ^ b32;
+      end
+      else begin
+         x8 <= a8 - b8;
+         x32 <= a32 | b32;
+      end
+      if (crc[17] ^ crc[40]) begin
+         y32 <= b32;
+         x64 <= a64 + b64;
+      end
+      else begin
+         y32 <= a32;
+         x64 <= a64;
+      end
+      if (crc[9]) hold <= a32;
+   end
+
+   // Reference values, computed without conditionals
+   reg [7:0] r8;
+   reg [31:0] r32;
+   reg [31:0] s32;
+   reg [63:0] r64;
+   reg [31:0] rhold = 0;
+   always @(posedge clk) begin
+      r8 <= ({8{crc[3]}} & (a8 + b8)) | ({8{~crc[3]}} & (a8 - b8));
+      r32 <= ({32{crc[3]}} & (a32 ^ b32)) | ({32{~crc[3]}} & (a32 | b32));
+      s32 <= ({32{crc[17] ^ crc[40]}} & b32) | ({32{~(crc[17] ^ crc[40])}} & a32);
+      r64 <= ({64{crc[17] ^ crc[40]}} & (a64 + b64)) | ({64{~(crc[17] ^ crc[40])}} & a64);
+      rhold <= ({32{crc[9]}} & a32) | ({32{~crc[9]}} & rhold);
+   end
+
+   always @ (posedge clk) begin
+      cyc <= cyc + 1;
+      crc <= {crc[62:0], crc[63] ^ crc[2] ^ crc[0]};
+      if (cyc > 1) begin
+         `check(x8, r8);
+         `check(x32, r32);
+         `check(y32, s32);
+         `check(x64, r64);
+         `check(hold, rhold);
+      end
+      if (cyc == 99) begin
+         $write("*-* All Finished *-*\n");
+         $finish;
+      end
+   end
+endmodule
@@ -0,0 +1,62 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain.
+// SPDX-FileCopyrightText: 2026 Wilson Snyder
+// SPDX-License-Identifier: CC0-1.0
+
+module t (/*AUTOARG*/
+   // Inputs
+   clk
+   );
+   input clk;
+
+   integer cyc = 0;
+   reg [15:0] in;
+   reg [7:0] out;
+
+   // Too large as a flat table, but the upper byte only selects one of a few
+   // functions of the lower byte, so a two level table is small
+   function automatic [7:0] decode(input [15:0] v);
+      reg [7:0] r;
+      r = 0;
+      case (v[15:8])
+        8'h00, 8'h10, 8'h20, 8'h30: r = v[7:0] + 8'd1;
+        8'h01, 8'h11, 8'h21, 8'h31: r = v[7:0] ^ 8'h5a;
+        8'h02, 8'h12, 8'h22, 8'h32: r = {v[3:0], v[7:4]};
+        8'h03, 8'h13, 8'h23, 8'h33: r = v[7:0] - 8'd3;
+        8'h04, 8'h14, 8'h24, 8'h34: begin
+           for (int i = 0; i < 8; ++i) r = r + {7'd0, v[i]};
+        end
+        8'h05, 8'h15, 8'h25, 8'h35: begin
+           for (int i = 0; i < 8; ++i) r[i] = v[7 - i];
+        end
+        8'h06, 8'h16, 8'h26, 8'h36: begin
+           for (int i = 0; i < 8; ++i) r = r ^ (v[7:0] >> i);
+        end
+        default: r = ~v[7:0];
+      endcase
+      return r;
+   endfunction
+
+   always @* begin
+      out = decode(in);
+   end
+
+   always @(posedge clk) begin
+      cyc <= cyc + 1;
+      in <= in * 16'h9e37 + 16'd1;
+      if (cyc == 0) begin
+         in <= 16'h0000;
+      end
+      else if (cyc > 1) begin
+`ifdef TEST_VERBOSE
+         $write("[%0t] in=%x out=%x\n", $time, in, out);
+`endif
+         if (out !== decode(in)) $stop;
+      end
+      if (cyc == 300) begin
+         $write("*-* All Finished *-*\n");
+         $finish;
+      end
+   end
+endmodule
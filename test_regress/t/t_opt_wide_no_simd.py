@@ -0,0 +1,25 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# This program is free software; you can redistribute it and/or modify it
+# under the terms of either the GNU Lesser General Public License Version 3
+# or the Perl Artistic License Version 2.0.
+# SPDX-FileCopyrightText: 2026 Wilson Snyder
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('vlt_all')
+test.top_filename = "t/t_opt_wide_simd.v"
+
+test.compile(verilator_flags2=["--stats -fno-wide-simd"])
+
+test.execute()
+
+if test.vlt:
+    test.file_grep(test.stats, r'Optimizations, expand kept for SIMD\s+(\d+)', 0)
+    files = test.glob_some(test.obj_dir + "/" + test.vm_prefix + "___024root*.cpp")
+    for filename in files:
+        test.file_grep_not(filename, r'VL_AND_W<')
+
+test.passes()
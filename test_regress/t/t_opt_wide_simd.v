@@ -0,0 +1,105 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain.
+// SPDX-FileCopyrightText: 2026 Wilson Snyder
+// SPDX-License-Identifier: CC0-1.0
+
+`define stop $stop
+`define check(got ,exp) do if ((got) !== (exp)) begin $write("%%Error: %s:%0d: cyc=%0d got='h%x exp='h%x\n", `__FILE__,`__LINE__, cyc, (got), (exp)); `stop; end while(0)
+
+module t (/*AUTOARG*/
+   // Inputs
+   clk
+   );
+   input clk;
+
+   integer cyc = 0;
+   reg [63:0] crc = 64'h5aef0c8d_d70a4497;
+
+   // Whole wide variables, operated on by the fixed size functions
+   reg [511:0] a = 0;
+   reg [511:0] b = 0;
+   reg [319:0] c = 0;
+   reg [319:0] d = 0;
+   reg [8:0] sh = 0;
+   always @(posedge clk) begin
+      a <= {a[447:0], crc};
+      b <= {b[447:0], crc[31:0], crc[63:32] ^ 32'h0f0f_1234};
+      c <= {c[255:0], crc};
+      d <= {c[255:0], cyc[1] ? crc : ~crc};
+      sh <= crc[8:0];
+   end
+
+   reg [511:0] x_and;
+   reg [511:0] x_or;
+   reg [511:0] x_xor;
+   reg [511:0] x_not;
+   reg [511:0] x_shl;
+   reg [511:0] x_shr;
+   reg [319:0] y_and;
+   reg y_eq;
+   reg y_neq;
+   always @(posedge clk) begin
+      x_and <= a & b;
+      x_or <= a | b;
+      x_xor <= a ^ b;
+      x_not <= ~a;
+      x_shl <= a << sh;
+      x_shr <= a >> sh;
+      y_and <= c & d;
+      y_eq <= c == d;
+      y_neq <= a != b;
+   end
+
+   // Reference values, computed a word or bit at a time
+   reg [511:0] r_and;
+   reg [511:0] r_or;
+   reg [511:0] r_xor;
+   reg [511:0] r_not;
+   reg [511:0] r_shl;
+   reg [511:0] r_shr;
+   reg [319:0] s_and;
+   reg s_eq;
+   reg s_neq;
+   always @(posedge clk) begin
+      for (int i = 0; i < 16; ++i) begin
+         r_and[i*32 +: 32] <= a[i*32 +: 32] & b[i*32 +: 32];
+         r_or[i*32 +: 32] <= a[i*32 +: 32] | b[i*32 +: 32];
+         r_xor[i*32 +: 32] <= a[i*32 +: 32] ^ b[i*32 +: 32];
+         r_not[i*32 +: 32] <= ~a[i*32 +: 32];
+      end
+      for (int i = 0; i < 512; ++i) begin
+         r_shl[i] <= (i >= int'(sh)) ? a[i - int'(sh)] : 1'b0;
+         r_shr[i] <= (i + int'(sh) < 512) ? a[i + int'(sh)] : 1'b0;
+      end
+      s_eq = 1'b1;
+      for (int i = 0; i < 10; ++i) begin
+         s_and[i*32 +: 32] <= c[i*32 +: 32] & d[i*32 +: 32];
+         if (c[i*32 +: 32] != d[i*32 +: 32]) s_eq = 1'b0;
+      end
+      s_neq = 1'b0;
+      for (int i = 0; i < 16; ++i) begin
+         if (a[i*32 +: 32] != b[i*32 +: 32]) s_neq = 1'b1;
+      end
+   end
+
+   always @ (posedge clk) begin
+      cyc <= cyc + 1;
+      crc <= {crc[62:0], crc[63] ^ crc[2] ^ crc[0]};
+      if (cyc > 1) begin
+         `check(x_and, r_and);
+         `check(x_or, r_or);
+         `check(x_xor, r_xor);
+         `check(x_not, r_not);
+         `check(x_shl, r_shl);
+         `check(x_shr, r_shr);
+         `check(y_and, s_and);
+         `check(y_eq, s_eq);
+         `check(y_neq, s_neq);
+      end
+      if (cyc == 99) begin
+         $write("*-* All Finished *-*\n");
+         $finish;
+      end
+   end
+endmodule
@@ -0,0 +1,22 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# This program is free software; you can redistribute it and/or modify it
+# under the terms of either the GNU Lesser General Public License Version 3
+# or the Perl Artistic License Version 2.0.
+# SPDX-FileCopyrightText: 2026 Wilson Snyder
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('vlt_all')
+
+test.compile(verilator_flags2=["--stats", "--param-share"])
+
+test.execute()
+
+test.file_grep(test.stats, r'Param, Shared parameters\s+(\d+)', 2)
+test.file_grep(test.stats, r'Param, Shared parameter values\s+(\d+)', 8)
+test.file_grep(test.stats, r'Param, Specialized modules\s+(\d+)', 2)
+
+test.passes()
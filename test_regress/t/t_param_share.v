@@ -0,0 +1,60 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain.
+// SPDX-FileCopyrightText: 2026 Wilson Snyder
+// SPDX-License-Identifier: CC0-1.0
+
+`define stop $stop
+`define checkh(gotv,expv) do if ((gotv) !== (expv)) begin $write("%%Error: %s:%0d:  got='h%x exp='h%x\n", `__FILE__,`__LINE__, (gotv), (expv)); `stop; end while(0);
+
+module t (/*AUTOARG*/
+   // Inputs
+   clk
+   );
+   input clk;
+
+   integer cyc = 0;
+
+   wire [31:0] out0, out1, out2, out3;
+
+   // HARTID and BASE are only used as data, so these share one module
+   core #(.HARTID(0), .BASE(32'h1000)) c0 (.clk, .out(out0));
+   // SEED is read in an initial block, so this is still specialized
+   core #(.HARTID(1), .BASE(32'h2000), .SEED(7)) c1 (.clk, .out(out1));
+   core #(.HARTID(2)) c2 (.clk, .out(out2));
+   // WIDTH is used in a data type, so this is still specialized
+   core #(.HARTID(3), .WIDTH(16)) c3 (.clk, .out(out3));
+
+   always @(posedge clk) begin
+      cyc <= cyc + 1;
+      if (cyc > 2) begin
+         `checkh(out1 - out0, 32'h1006);
+         `checkh(out2 - out0, 32'h7008);
+         `checkh(out3 - out0, 32'h700c);
+      end
+      if (cyc == 9) begin
+         `checkh(out0, 32'h100d);
+         $write("*-* All Finished *-*\n");
+         $finish;
+      end
+   end
+endmodule
+
+module core #(
+   parameter int HARTID = 0,
+   parameter logic [31:0] BASE = 32'h8000,
+   parameter int WIDTH = 32,
+   parameter int SEED = 5
+) (
+   input clk,
+   output logic [31:0] out
+);
+   /*verilator no_inline_module*/
+   logic [WIDTH-1:0] cnt = 0;
+   logic [31:0] seed;
+   initial seed = SEED;
+   always @(posedge clk) begin
+      cnt <= cnt + 1;
+      out <= BASE + (HARTID << 2) + 32'(cnt) + seed;
+   end
+endmodule
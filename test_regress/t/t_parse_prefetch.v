@@ -0,0 +1,21 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain.
+// SPDX-FileCopyrightText: 2026 Wilson Snyder
+// SPDX-License-Identifier: CC0-1.0
+
+module t;
+   logic [7:0] o;
+
+   sub sub (.o);
+
+   initial begin
+`ifndef PREFETCH_VALUE
+      $stop;  // Define from earlier file was lost
+`endif
+      #1;
+      if (o !== `PREFETCH_VALUE) $stop;
+      $write("*-* All Finished *-*\n");
+      $finish;
+   end
+endmodule
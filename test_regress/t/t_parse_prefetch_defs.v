@@ -0,0 +1,12 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain.
+// SPDX-FileCopyrightText: 2026 Wilson Snyder
+// SPDX-License-Identifier: CC0-1.0
+
+// Read before t_parse_prefetch.v, which depends on this define
+`define PREFETCH_VALUE 8'h5a
+
+module sub (output logic [7:0] o);
+   assign o = `PREFETCH_VALUE;
+endmodule
@@ -0,0 +1,29 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# This program is free software; you can redistribute it and/or modify it
+# under the terms of either the GNU Lesser General Public License Version 3
+# or the Perl Artistic License Version 2.0.
+# SPDX-FileCopyrightText: 2026 Wilson Snyder
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('vlt')
+
+test.compile(v_flags2=["--prof-pgo-branch", "--stats"])
+
+test.file_grep(test.stats, r'Branch, PGO counters\s+[1-9]')
+
+test.execute(all_run_flags=["+verilator+prof+vlt+file+" + test.obj_dir + "/profile.vlt"])
+
+test.file_grep(test.obj_dir + "/profile.vlt", r'profile_data -model "\w+" -branch ')
+
+test.compile(v_flags2=["--stats", test.obj_dir + "/profile.vlt"])
+
+test.file_grep(test.stats, r'Branch, PGO hints\s+[1-9]')
+test.file_grep(test.stats, r'Branch, PGO cold functions\s+[1-9]')
+
+test.execute()
+
+test.passes()
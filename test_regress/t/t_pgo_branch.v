@@ -0,0 +1,38 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain.
+// SPDX-FileCopyrightText: 2026 Wilson Snyder
+// SPDX-License-Identifier: CC0-1.0
+
+module t (/*AUTOARG*/
+   // Inputs
+   clk
+   );
+   input clk;
+
+   integer cyc = 0;
+   reg [31:0] crc = 32'h5aa5_1234;
+   reg [31:0] sum = 0;
+   reg [31:0] errs = 0;
+
+   always @(posedge clk) begin
+      cyc <= cyc + 1;
+      crc <= {crc[30:0], crc[31] ^ crc[21] ^ crc[1] ^ crc[0]};
+      if (cyc != 12345) begin
+         // Always taken
+         sum <= sum + crc;
+      end
+      else begin
+         // Never taken, and large, so moved into a cold function
+         errs = errs + 1;
+         $display("[%0t] cyc=%0d crc=%x sum=%x errs=%0d", $time, cyc, crc, sum, errs);
+         $display("[%0t] crc*3=%x sum^crc=%x", $time, crc * 3, sum ^ crc);
+         $display("[%0t] crc>>3=%x sum<<5=%x", $time, crc >> 3, sum << 5);
+      end
+      if (cyc == 999) begin
+         if (errs != 0) $stop;
+         $write("*-* All Finished *-*\n");
+         $finish;
+      end
+   end
+endmodule
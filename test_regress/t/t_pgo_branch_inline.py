@@ -0,0 +1,34 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# This program is free software; you can redistribute it and/or modify it
+# under the terms of either the GNU Lesser General Public License Version 3
+# or the Perl Artistic License Version 2.0.
+# SPDX-FileCopyrightText: 2026 Wilson Snyder
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('vlt')
+test.top_filename = "t/t_pgo_inline_cfuncs.v"
+
+# Profile without CFunc inlining
+test.compile(v_flags2=["--prof-pgo-branch", "--stats"])
+
+test.file_grep(test.stats, r'Optimizations, Inlined CFuncs\s+0')
+
+test.execute(all_run_flags=["+verilator+prof+vlt+file+" + test.obj_dir + "/profile.vlt"])
+
+# Branches are named by source location and ordinal
+test.file_grep(test.obj_dir + "/profile.vlt",
+               r'profile_data -model "\w+" -branch "\S+\.v:\d+:\d+:0:then"')
+
+# Use it with CFunc inlining, the branch in the inlined hot function still gets its hint
+test.compile(v_flags2=["--stats", test.obj_dir + "/profile.vlt"])
+
+test.file_grep(test.stats, r'Optimizations, Inlined CFuncs profile inline\s+[1-9]')
+test.file_grep(test.stats, r'Branch, PGO hints\s+[1-9]')
+
+test.execute()
+
+test.passes()
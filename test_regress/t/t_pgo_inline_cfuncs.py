@@ -0,0 +1,41 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# This program is free software; you can redistribute it and/or modify it
+# under the terms of either the GNU Lesser General Public License Version 3
+# or the Perl Artistic License Version 2.0.
+# SPDX-FileCopyrightText: 2026 Wilson Snyder
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('vlt')
+
+# Plain --prof-pgo counts no function calls, so still inlines
+test.compile(v_flags2=["--prof-pgo", "--stats"])
+
+test.file_grep(test.stats, r'Optimizations, Inlined CFuncs\s+[1-9]')
+test.file_grep_not(test.stats, r'Branch, PGO counters')
+
+test.compile(v_flags2=["--prof-pgo-branch", "--stats"])
+
+test.file_grep(test.stats, r'Optimizations, Inlined CFuncs\s+0')
+
+test.execute(all_run_flags=["+verilator+prof+vlt+file+" + test.obj_dir + "/profile.vlt"])
+
+test.file_grep(test.obj_dir + "/profile.vlt", r'profile_data -model "\w+" -function ')
+
+test.compile(v_flags2=["--stats", test.obj_dir + "/profile.vlt"])
+
+report = test.obj_dir + "/" + test.vm_prefix + "__inline_cfuncs.txt"
+test.file_grep(report, r'Verilator CFunc inlining report')
+# The hot block's function is inlined, the cold block's is not, though small
+# enough that it is inlined without profile data
+test.file_grep(report, r'^inline +hot +\d+ +1 ')
+test.file_grep(report, r'^keep +cold +\d +1 ')
+test.file_grep(test.stats, r'Optimizations, Inlined CFuncs profile inline\s+[1-9]')
+test.file_grep(test.stats, r'Optimizations, Inlined CFuncs profile keep\s+[1-9]')
+
+test.execute()
+
+test.passes()
@@ -0,0 +1,40 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain.
+// SPDX-FileCopyrightText: 2026 Wilson Snyder
+// SPDX-License-Identifier: CC0-1.0
+
+module t (/*AUTOARG*/
+   // Inputs
+   clk
+   );
+   input clk;
+
+   integer cyc = 0;
+   reg [31:0] crc = 32'h5aa5_1234;
+   reg [31:0] sum = 0;
+   reg        rare = 0;
+   reg [31:0] snap_a = 0;
+   reg [31:0] snap_b = 0;
+   reg [31:0] snap_c = 0;
+
+   // Hot, its function is called every cycle
+   always @(posedge clk) begin
+      cyc <= cyc + 1;
+      crc <= {crc[30:0], crc[31] ^ crc[21] ^ crc[1] ^ crc[0]};
+      sum <= sum + crc;
+      rare <= (cyc == 5);
+      if (cyc == 9999) begin
+         $write("[%0t] sum=%x snap=%x %x %x\n", $time, sum, snap_a, snap_b, snap_c);
+         $write("*-* All Finished *-*\n");
+         $finish;
+      end
+   end
+
+   // Cold, its function is called once
+   always @(posedge rare) begin
+      snap_a <= sum ^ {cyc[15:0], cyc[15:0]};
+      snap_b <= sum + crc * 3;
+      snap_c <= (crc >> 3) - (sum << 5);
+   end
+endmodule
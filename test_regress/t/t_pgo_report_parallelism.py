@@ -0,0 +1,38 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# This program is free software; you can redistribute it and/or modify it
+# under the terms of either the GNU Lesser General Public License Version 3
+# or the Perl Artistic License Version 2.0.
+# SPDX-FileCopyrightText: 2026 Wilson Snyder
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('vltmt')
+test.top_filename = "t/t_gen_alw.v"  # It doesn't really matter what test
+
+report = test.obj_dir + "/" + test.vm_prefix + "__parallelism.txt"
+
+test.compile(v_flags2=["--prof-pgo", "--report-parallelism"], threads=2)
+
+test.file_grep(report, r'No mtask profile data')
+test.file_grep(report, r'Critical path:')
+
+test.execute(all_run_flags=[
+    "+verilator+prof+exec+start+0",
+    " +verilator+prof+exec+file+/dev/null",
+    " +verilator+prof+vlt+file+" + test.obj_dir + "/profile.vlt"])  # yapf:disable
+
+test.compile(v_flags2=["--report-parallelism", " " + test.obj_dir + "/profile.vlt"], threads=2)
+
+test.file_grep_not(report, r'No mtask profile data')
+test.file_grep(report, r"Region '\w+': \d+ mtasks, \d+ with profile data")
+test.file_grep(report, r'Critical path cost: +\d+')
+test.file_grep(report, r'Parallelism factor: +[\d.]+')
+test.file_grep(report, r'mt\d+ +cost +\d+ +[\d.]+% of critical path')
+test.file_grep(report, r'line +[\d.]+% +\S*t_gen_alw.v:\d+')
+
+test.execute()
+
+test.passes()
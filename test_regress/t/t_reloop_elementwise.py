@@ -0,0 +1,24 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# This program is free software; you can redistribute it and/or modify it
+# under the terms of either the GNU Lesser General Public License Version 3
+# or the Perl Artistic License Version 2.0.
+# SPDX-FileCopyrightText: 2026 Wilson Snyder
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('simulator')
+
+test.compile(
+    verilator_flags2=["-unroll-count 1024", test.wno_unopthreads_for_few_cores, "--stats"])
+
+test.execute()
+
+if test.vlt:
+    # Note, with vltmt this might be split differently, so only checking vlt
+    test.file_grep(test.stats, r'Optimizations, Reloop element-wise iterations\s+(\d+)', 128)
+    test.file_grep(test.stats, r'Optimizations, Reloop element-wise\s+(\d+)', 2)
+
+test.passes()
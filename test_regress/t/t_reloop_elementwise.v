@@ -0,0 +1,47 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain.
+// SPDX-FileCopyrightText: 2026 Wilson Snyder
+// SPDX-License-Identifier: CC0-1.0
+
+module t;
+
+   int mem [63:0];
+   int key [64:0];
+   int sum [63:0];
+   int shift [63:0];
+
+   initial begin
+      for (int i = 0; i < 65; i = i + 1) begin
+         key[i] = i * 3 + 1;
+      end
+      for (int i = 0; i < 64; i = i + 1) begin
+         mem[i] = i;
+         shift[i] = i;
+      end
+
+      // Element-wise, reading the element assigned
+      for (int i = 0; i < 64; i = i + 1) begin
+         mem[i] = mem[i] ^ key[i + 1];
+      end
+      // Element-wise, from other arrays
+      for (int i = 0; i < 64; i = i + 1) begin
+         sum[i] = mem[i] + (key[i] << 2);
+      end
+      // Reads an element assigned by another iteration, must not merge
+      for (int i = 0; i < 63; i = i + 1) begin
+         shift[i] = shift[i + 1] + 1;
+      end
+
+      for (int i = 0; i < 64; i = i + 1) begin
+         if (mem[i] != (i ^ (i * 3 + 4))) $stop;
+         if (sum[i] != (mem[i] + ((i * 3 + 1) << 2))) $stop;
+         if (i < 63 && shift[i] != i + 2) $stop;
+      end
+      if (shift[63] != 63) $stop;
+
+      $write("*-* All Finished *-*\n");
+      $finish;
+   end
+
+endmodule
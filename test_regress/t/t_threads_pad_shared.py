@@ -0,0 +1,36 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# This program is free software; you can redistribute it and/or modify it
+# under the terms of either the GNU Lesser General Public License Version 3
+# or the Perl Artistic License Version 2.0.
+# SPDX-FileCopyrightText: 2026 Wilson Snyder
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('vltmt')
+
+test.compile(verilator_flags2=["--stats", "--threads-pad-shared"], threads=4)
+
+test.execute()
+
+test.file_grep(test.stats, r'Optimizations, Variable order false shared lines\s+(\d+)')
+test.file_grep(test.stats, r'Optimizations, Variable order false shared lines padded\s+(\d+)')
+test.file_grep(test.stats, r'Optimizations, Variable order padded variables\s+(\d+)')
+report = test.obj_dir + "/" + test.vm_prefix + "__false_sharing.txt"
+test.file_grep(report, r'Cache lines written by multiple threads')
+
+# Each padded variable starts a cache line, in the estimate and in the model
+padded = test.file_grep(report, r'Padded variables: (\d+)')
+moved = re.findall(r'Moved to new cache line: (\w+) \(offset (\d+)\)',
+                   test.file_contents(report))
+if padded and len(moved) != int(padded[0][0]):
+    test.error("Padded variable count does not match variables listed")
+for name, offset in moved:
+    if int(offset) % 64:
+        test.error("Padded variable " + name + " at offset " + offset + " not line aligned")
+    test.file_grep(test.run_log_filename, r'^' + name + r' line offset 0$')
+test.file_grep(test.stats, r'Optimizations, Variable order padded variables\s+(\d+)$', len(moved))
+
+test.passes()
@@ -0,0 +1,56 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain.
+// SPDX-FileCopyrightText: 2026 Wilson Snyder
+// SPDX-License-Identifier: CC0-1.0
+
+`define stop $stop
+`define show_offset(var) $display(`"var line offset %0d`", $c32("reinterpret_cast<uintptr_t>(&", var, ") % VL_CACHE_LINE_BYTES"))
+`define checkh(gotv,expv) do if ((gotv) !== (expv)) begin $write("%%Error: %s:%0d:  got='h%x exp='h%x\n", `__FILE__,`__LINE__, (gotv), (expv)); `stop; end while(0);
+
+module t (/*AUTOARG*/
+   // Inputs
+   clk
+   );
+   input clk;
+
+   int cyc = 0;
+
+   // Small, independently written state, likely to land on one cache line
+   logic [7:0] cnt_a = 0;
+   logic [7:0] cnt_b = 0;
+   logic [7:0] cnt_c = 0;
+   logic [7:0] cnt_d = 0;
+   logic [63:0] lfsr_a = 64'h5aef0c8d_d70a4497;
+   logic [63:0] lfsr_b = 64'h5aef0c8d_d70a4497;
+
+   always @(posedge clk) begin
+      lfsr_a <= {lfsr_a[62:0], lfsr_a[63] ^ lfsr_a[2] ^ lfsr_a[0]};
+      cnt_a <= cnt_a + 8'd1 + {7'd0, ^lfsr_a[31:0]};
+   end
+   always @(posedge clk) begin
+      lfsr_b <= {lfsr_b[62:0], lfsr_b[63] ^ lfsr_b[2] ^ lfsr_b[0]};
+      cnt_b <= cnt_b + 8'd1 + {7'd0, ^lfsr_b[31:0]};
+   end
+   always @(posedge clk) cnt_c <= cnt_c + 8'd2;
+   always @(posedge clk) cnt_d <= cnt_d + 8'd3;
+
+   always @(posedge clk) begin
+      cyc <= cyc + 1;
+      if (cyc == 20) begin
+         // Same sequence, so must match regardless of layout
+         `checkh(cnt_a, cnt_b);
+         `checkh(cnt_c, 8'd40);
+         `checkh(cnt_d, 8'd60);
+         // Offset within the cache line of each variable, to check the layout
+         `show_offset(cnt_a);
+         `show_offset(cnt_b);
+         `show_offset(cnt_c);
+         `show_offset(cnt_d);
+         `show_offset(lfsr_a);
+         `show_offset(lfsr_b);
+         $write("*-* All Finished *-*\n");
+         $finish;
+      end
+   end
+endmodule